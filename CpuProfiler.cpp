@@ -0,0 +1,163 @@
+#include "CpuProfiler.h"
+
+#ifdef CPU_PROFILING
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace
+{
+    struct Calibration
+    {
+        uint64_t timestamp;
+        std::chrono::steady_clock::time_point time;
+    };
+
+    Calibration calibrate()
+    {
+        return { CpuProfiler::readTimestamp(), std::chrono::steady_clock::now() };
+    }
+
+    // Trace times are relative to the first use of the profiler.
+    const Calibration start = calibrate();
+}
+
+thread_local CpuProfiler::ThreadZones* CpuProfiler::threadZones = nullptr;
+
+// Hands the ring back when its thread exits.
+struct ThreadZonesOwner
+{
+    CpuProfiler::ThreadZones* zones = nullptr;
+
+    ~ThreadZonesOwner();
+};
+
+namespace
+{
+    std::mutex registryMutex;
+    std::vector<std::unique_ptr<CpuProfiler::ThreadZones>> registry;
+    thread_local ThreadZonesOwner threadZonesOwner;
+
+    void writeEscaped(std::ofstream& file, const char* text)
+    {
+        for (; *text; text++)
+        {
+            if (*text == '"' || *text == '\\')
+                file << '\\';
+            file << *text;
+        }
+    }
+}
+
+ThreadZonesOwner::~ThreadZonesOwner()
+{
+    std::lock_guard<std::mutex> lock(registryMutex);
+    if (zones)
+        zones->inUse = false;
+}
+
+CpuProfiler::ThreadZones* CpuProfiler::registerThread()
+{
+    std::lock_guard<std::mutex> lock(registryMutex);
+    ThreadZones* zones = nullptr;
+    for (std::unique_ptr<ThreadZones>& unused : registry)
+    {
+        if (!unused->inUse)
+        {
+            zones = unused.get();
+            break;
+        }
+    }
+    if (!zones)
+    {
+        registry.push_back(std::make_unique<ThreadZones>());
+        zones = registry.back().get();
+        zones->id = static_cast<uint32_t>(registry.size());
+    }
+
+    zones->inUse = true;
+    zones->name = "Thread " + std::to_string(zones->id);
+    threadZones = zones;
+    threadZonesOwner.zones = zones;
+    return zones;
+}
+
+void CpuProfiler::setThreadName(const char* name)
+{
+    ThreadZones* zones = threadZones ? threadZones : registerThread();
+    std::lock_guard<std::mutex> lock(registryMutex);
+    zones->name = name;
+}
+
+bool CpuProfiler::writeChromeTrace(const char* path)
+{
+    std::ofstream file(path, std::ios::trunc);
+    if (!file)
+        return false;
+
+    // rdtsc runs at a constant rate, measured against the clock since start.
+    const Calibration now = calibrate();
+    const double seconds = std::chrono::duration<double>(now.time - start.time).count();
+    const double microsecondsPerTick = seconds > 0.0 && now.timestamp > start.timestamp
+        ? seconds * 1000000.0 / static_cast<double>(now.timestamp - start.timestamp) : 0.0;
+
+    std::lock_guard<std::mutex> lock(registryMutex);
+    file << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+
+    bool first = true;
+    for (const std::unique_ptr<ThreadZones>& zones : registry)
+    {
+        file << (first ? "" : ",") << "\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << zones->id
+            << ",\"args\":{\"name\":\"";
+        writeEscaped(file, zones->name.c_str());
+        file << "\"}}";
+        first = false;
+
+        const uint64_t head = zones->head.load(std::memory_order_acquire);
+        const uint64_t oldest = head > ZonesPerThread ? head - ZonesPerThread : 0;
+
+        struct Copy
+        {
+            const char* name;
+            uint64_t begin;
+            uint64_t end;
+        };
+        std::vector<Copy> copies;
+        copies.reserve(head - oldest);
+        for (uint64_t index = oldest; index < head; index++)
+        {
+            const Zone& zone = zones->zones[index & (ZonesPerThread - 1)];
+            copies.push_back({ zone.name.load(std::memory_order_relaxed), zone.begin.load(std::memory_order_relaxed),
+                zone.end.load(std::memory_order_relaxed) });
+        }
+
+        // The owner may have lapped the copy; whatever it could have written
+        // over since is dropped. It can be writing the zone at the new head,
+        // which takes the slot of one more.
+        std::atomic_thread_fence(std::memory_order_acquire);
+        const uint64_t newHead = zones->head.load(std::memory_order_relaxed);
+        const uint64_t valid = newHead + 1 > ZonesPerThread ? newHead + 1 - ZonesPerThread : 0;
+
+        for (uint64_t index = std::max(oldest, valid); index < head; index++)
+        {
+            const Copy& zone = copies[index - oldest];
+            if (zone.begin < start.timestamp || zone.end < zone.begin)
+                continue;
+
+            file << ",\n{\"name\":\"";
+            writeEscaped(file, zone.name);
+            file << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << zones->id
+                << ",\"ts\":" << static_cast<double>(zone.begin - start.timestamp) * microsecondsPerTick
+                << ",\"dur\":" << static_cast<double>(zone.end - zone.begin) * microsecondsPerTick << "}";
+        }
+    }
+
+    file << "\n]}\n";
+    return static_cast<bool>(file);
+}
+
+#endif
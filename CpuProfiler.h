@@ -0,0 +1,100 @@
+#pragma once
+
+// Scoped CPU timings for a Chrome trace (chrome://tracing or ui.perfetto.dev).
+// PROFILE_ZONE("Name") times the rest of the enclosing block; the name has to
+// be a string literal. Without CPU_PROFILING the macros expand to nothing and
+// none of this is compiled.
+#ifdef CPU_PROFILING
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#else
+#include <x86intrin.h>
+#endif
+
+// Every thread writes its zones to a ring of its own, so recording takes two
+// rdtsc reads and a few stores, without locks. Rings are kept after their
+// thread exits, and reused by the next new thread.
+class CpuProfiler
+{
+public:
+    // Per thread; older zones are overwritten.
+    static constexpr uint32_t ZonesPerThread = 1 << 15;
+
+    static uint64_t readTimestamp() { return __rdtsc(); }
+
+    static void addZone(const char* name, uint64_t begin, uint64_t end)
+    {
+        ThreadZones* zones = threadZones ? threadZones : registerThread();
+        const uint64_t index = zones->head.load(std::memory_order_relaxed);
+        // Pairs with the fence in writeChromeTrace(): if the export sees any
+        // of the stores below, it also sees head at index.
+        std::atomic_thread_fence(std::memory_order_release);
+        Zone& zone = zones->zones[index & (ZonesPerThread - 1)];
+        zone.name.store(name, std::memory_order_relaxed);
+        zone.begin.store(begin, std::memory_order_relaxed);
+        zone.end.store(end, std::memory_order_relaxed);
+        zones->head.store(index + 1, std::memory_order_release);
+    }
+
+    // Shown as the calling thread's name in the trace.
+    static void setThreadName(const char* name);
+
+    // Writes every thread's zones still in its ring. Other threads may go on
+    // recording meanwhile; zones they overwrite during the export are left
+    // out.
+    static bool writeChromeTrace(const char* path);
+
+    // Only public for the profiler's own .cpp.
+    struct Zone
+    {
+        std::atomic<const char*> name;
+        std::atomic<uint64_t> begin;
+        std::atomic<uint64_t> end;
+    };
+
+    struct ThreadZones
+    {
+        Zone zones[ZonesPerThread];
+        // Zones written so far; the newest is at head - 1.
+        std::atomic<uint64_t> head = 0;
+        uint32_t id = 0;
+        std::string name;
+        bool inUse = false;
+    };
+
+private:
+    static thread_local ThreadZones* threadZones;
+
+    static ThreadZones* registerThread();
+};
+
+class CpuZone
+{
+public:
+    explicit CpuZone(const char* name) : name(name), begin(CpuProfiler::readTimestamp()) {}
+    ~CpuZone() { CpuProfiler::addZone(name, begin, CpuProfiler::readTimestamp()); }
+
+    CpuZone(const CpuZone&) = delete;
+    CpuZone& operator=(const CpuZone&) = delete;
+
+private:
+    const char* name;
+    uint64_t begin;
+};
+
+#define PROFILE_CONCAT_INNER(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_INNER(a, b)
+#define PROFILE_ZONE(name) CpuZone PROFILE_CONCAT(cpuZone, __LINE__)(name)
+#define PROFILE_THREAD(name) CpuProfiler::setThreadName(name)
+
+#else
+
+#define PROFILE_ZONE(name)
+#define PROFILE_THREAD(name)
+
+#endif
@@ -0,0 +1,1673 @@
+#include <algorithm>
+#include <cwchar>
+#include <fstream>
+#include <iterator>
+
+#include "d3dx12.h"
+
+#include "WinApp.h"
+#include "D3D12Backend.h"
+#include "CpuProfiler.h"
+#include "ShaderTypes.h"
+
+#include "unlit_untextured_vertex_shader.h"
+#include "lit_untextured_vertex_shader.h"
+#include "unlit_textured_vertex_shader.h"
+#include "lit_textured_vertex_shader.h"
+#include "unlit_untextured_instanced_vertex_shader.h"
+#include "lit_untextured_instanced_vertex_shader.h"
+#include "unlit_textured_instanced_vertex_shader.h"
+#include "lit_textured_instanced_vertex_shader.h"
+#include "unlit_untextured_pixel_shader.h"
+#include "lit_untextured_pixel_shader.h"
+#include "unlit_textured_pixel_shader.h"
+#include "lit_textured_pixel_shader.h"
+
+namespace
+{
+    template <size_t N>
+    D3D12_SHADER_BYTECODE getBytecode(const BYTE (&blob)[N])
+    {
+        return { blob, N };
+    }
+
+    // Compiled shader permutations, indexed by getShaderPermutation(). Pixel
+    // shaders do not depend on ShaderFeatureInstanced.
+    const D3D12_SHADER_BYTECODE vertexShaders[ShaderPermutationCount] =
+    {
+        getBytecode(vs_unlit_untextured),
+        getBytecode(vs_lit_untextured),
+        getBytecode(vs_unlit_textured),
+        getBytecode(vs_lit_textured),
+        getBytecode(vs_unlit_untextured_instanced),
+        getBytecode(vs_lit_untextured_instanced),
+        getBytecode(vs_unlit_textured_instanced),
+        getBytecode(vs_lit_textured_instanced)
+    };
+
+    const D3D12_SHADER_BYTECODE pixelShaders[ShaderFeatureInstanced] =
+    {
+        getBytecode(ps_unlit_untextured),
+        getBytecode(ps_lit_untextured),
+        getBytecode(ps_unlit_textured),
+        getBytecode(ps_lit_textured)
+    };
+
+    D3D12_RESOURCE_STATES getResourceState(ResourceState state)
+    {
+        const uint32_t flags = static_cast<uint32_t>(state);
+        D3D12_RESOURCE_STATES result = D3D12_RESOURCE_STATE_COMMON;
+        if (flags & static_cast<uint32_t>(ResourceState::RenderTarget))
+            result |= D3D12_RESOURCE_STATE_RENDER_TARGET;
+        if (flags & static_cast<uint32_t>(ResourceState::DepthWrite))
+            result |= D3D12_RESOURCE_STATE_DEPTH_WRITE;
+        if (flags & static_cast<uint32_t>(ResourceState::DepthRead))
+            result |= D3D12_RESOURCE_STATE_DEPTH_READ;
+        if (flags & static_cast<uint32_t>(ResourceState::ShaderResource))
+            result |= D3D12_RESOURCE_STATE_ALL_SHADER_RESOURCE;
+        if (flags & static_cast<uint32_t>(ResourceState::CopySource))
+            result |= D3D12_RESOURCE_STATE_COPY_SOURCE;
+        if (flags & static_cast<uint32_t>(ResourceState::CopyDest))
+            result |= D3D12_RESOURCE_STATE_COPY_DEST;
+        if (flags & static_cast<uint32_t>(ResourceState::Present))
+            result |= D3D12_RESOURCE_STATE_PRESENT;
+        return result;
+    }
+}
+
+D3D12CommandRecorder::D3D12CommandRecorder(D3D12Backend& backend, bool bundle) :
+    backend(backend),
+    bundle(bundle)
+{
+}
+
+void D3D12CommandRecorder::setPipeline(PipelineHandle pipeline)
+{
+    const uint32_t entry = backend.pipelines->resolve(pipeline.id - 1, !bundle);
+    commandList->SetPipelineState(backend.pipelines->getObject(entry).Get());
+}
+
+void D3D12CommandRecorder::setConstantBuffer(BufferHandle buffer, size_t offset)
+{
+    commandList->SetGraphicsRootConstantBufferView(
+        D3D12Backend::FrameConstantsParameter,
+        backend.buffers[buffer.id - 1].resource->GetGPUVirtualAddress() + offset
+    );
+}
+
+void D3D12CommandRecorder::setMaterialTable(BufferHandle buffer, size_t offset)
+{
+    commandList->SetGraphicsRootShaderResourceView(
+        D3D12Backend::MaterialTableParameter,
+        backend.buffers[buffer.id - 1].resource->GetGPUVirtualAddress() + offset
+    );
+}
+
+void D3D12CommandRecorder::setMaterial(uint32_t material)
+{
+    commandList->SetGraphicsRoot32BitConstant(D3D12Backend::DrawConstantsParameter, material, 0);
+}
+
+void D3D12CommandRecorder::setObjectTable(BufferHandle buffer, size_t offset)
+{
+    commandList->SetGraphicsRootShaderResourceView(
+        D3D12Backend::ObjectTableParameter,
+        backend.buffers[buffer.id - 1].resource->GetGPUVirtualAddress() + offset
+    );
+}
+
+void D3D12CommandRecorder::setObject(uint32_t object)
+{
+    commandList->SetGraphicsRoot32BitConstant(D3D12Backend::DrawConstantsParameter, object, 1);
+}
+
+void D3D12CommandRecorder::setVertexBuffer(BufferHandle buffer)
+{
+    commandList->IASetVertexBuffers(0, 1, &backend.buffers[buffer.id - 1].view);
+}
+
+void D3D12CommandRecorder::setInstanceBuffer(BufferHandle buffer, size_t offset, uint32_t instanceCount)
+{
+    const D3D12_VERTEX_BUFFER_VIEW view = {
+        .BufferLocation = backend.buffers[buffer.id - 1].resource->GetGPUVirtualAddress() + offset,
+        .SizeInBytes = static_cast<UINT>(instanceCount * sizeof(InstanceData)),
+        .StrideInBytes = sizeof(InstanceData)
+    };
+    commandList->IASetVertexBuffers(1, 1, &view);
+}
+
+void D3D12CommandRecorder::draw(uint32_t vertexCount, uint32_t instanceCount,
+    uint32_t firstVertex, uint32_t firstInstance)
+{
+    commandList->DrawInstanced(vertexCount, instanceCount, firstVertex, firstInstance);
+}
+
+void D3D12CommandRecorder::drawIndirect(BufferHandle buffer, size_t offset, uint32_t drawCount)
+{
+    // Upload heap buffers are always in GENERIC_READ, which covers
+    // INDIRECT_ARGUMENT.
+    commandList->ExecuteIndirect(backend.drawCommandSignature.Get(), drawCount,
+        backend.buffers[buffer.id - 1].resource.Get(), offset, nullptr, 0);
+}
+
+void D3D12CommandRecorder::executeBundle(BundleHandle bundle)
+{
+    commandList->ExecuteBundle(backend.bundles[bundle.id - 1].Get());
+}
+
+D3D12Backend::D3D12Backend(UINT framesInFlight) :
+    gpuProfiler(framesInFlight),
+    frameSync(framesInFlight),
+    recorder(*this),
+    bundleRecorder(*this, true)
+{
+    parallelRecorders.reserve(MaxParallelRecorders);
+    for (UINT i = 0; i < MaxParallelRecorders; i++)
+        parallelRecorders.emplace_back(*this);
+}
+
+void D3D12Backend::init(uint32_t width, uint32_t height)
+{
+    this->width = width;
+    this->height = height;
+    backBufferCount = std::max(MinBackBufferCount, frameSync.getFramesInFlight());
+    scissorRect = CD3DX12_RECT(0, 0, LONG_MAX, LONG_MAX);
+    viewport = CD3DX12_VIEWPORT(0.0f, 0.0f, static_cast<float>(width), static_cast<float>(height));
+
+    loadPipeline();
+    createRootSignature();
+    createCommandSignature();
+    createPipelineCache();
+    createCommandList();
+    createDepthBuffer();
+    createFrameGraph();
+    createFence();
+    createUploadRing();
+    createCopyQueue();
+    createTimestampQueries();
+}
+
+void D3D12Backend::loadPipeline()
+{
+    UINT dxgiFactoryFlags = 0;
+
+    ComPtr<IDXGIFactory7> factory;
+    ThrowIfFailed(CreateDXGIFactory2(dxgiFactoryFlags, IID_PPV_ARGS(&factory)));
+
+    ThrowIfFailed(D3D12CreateDevice(
+        nullptr,
+        D3D_FEATURE_LEVEL_12_0,
+        IID_PPV_ARGS(&device)
+    ));
+
+    createCommandQueue();
+    createSwapChain(factory);
+    createHeaps();
+    createRenderTargets();
+    createCommandAllocators();
+}
+
+TextureHandle D3D12Backend::createTexture(const TextureDesc& desc) {
+    UINT const bmp_px_size = 4;
+    ComPtr<ID3D12Resource> texture_resource;
+
+    // Budowa waciwego zasobu tekstury
+    D3D12_RESOURCE_DESC tex_resource_desc = {
+    .Dimension = D3D12_RESOURCE_DIMENSION_TEXTURE2D,
+    .Alignment = 0,
+    .Width = desc.width,
+    .Height = desc.height,
+    .DepthOrArraySize = 1,
+    .MipLevels = 1,
+    .Format = DXGI_FORMAT_R8G8B8A8_UNORM,
+    .SampleDesc = {.Count = 1, .Quality = 0 },
+    .Layout = D3D12_TEXTURE_LAYOUT_UNKNOWN,
+    .Flags = D3D12_RESOURCE_FLAG_NONE
+    };
+
+    GpuMemoryPool::Allocation texture_allocation;
+    texture_resource = createPlacedResource(textureHeaps, tex_resource_desc,
+        D3D12_RESOURCE_STATE_COMMON, nullptr, textures.size(), texture_allocation);
+
+    // Dane tekstury trafiaj do bufora poredniego (staging) i s kopiowane
+    // na kolejce kopiujcej, bez czekania na GPU
+    D3D12_PLACED_SUBRESOURCE_FOOTPRINT Layouts[1];
+    UINT NumRows[1];
+    UINT64 RowSizesInBytes[1];
+    UINT64 RequiredSize = 0;
+    device->GetCopyableFootprints(
+        &tex_resource_desc, 0, 1, 0, Layouts, NumRows,
+        RowSizesInBytes, &RequiredSize
+    );
+
+    const size_t staging_offset = allocateStaging(
+        static_cast<size_t>(RequiredSize), D3D12_TEXTURE_DATA_PLACEMENT_ALIGNMENT
+    );
+    Layouts[0].Offset += staging_offset;
+
+    // - skopiowanie danych tekstury do pom. bufora
+    UINT8* map_tex_data = buffers[stagingBuffer.id - 1].data;
+    for (UINT y = 0; y < NumRows[0]; ++y) {
+        memcpy(
+            map_tex_data + Layouts[0].Offset + SIZE_T(Layouts[0].Footprint.RowPitch) * y,
+            desc.pixels + SIZE_T(desc.width) * bmp_px_size * y,
+            static_cast<SIZE_T>(RowSizesInBytes[0])
+        );
+    }
+
+    // - zlecenie procesorowi GPU jego skopiowania do waciwego
+    // zasobu tekstury; tekstura jest w stanie COMMON, kopia sama j
+    // promuje do COPY_DEST, a po niej wraca do COMMON, skd rysowanie
+    // promuje j do PIXEL_SHADER_RESOURCE
+    D3D12_TEXTURE_COPY_LOCATION Dst = {
+    .pResource = texture_resource.Get(),
+    .Type = D3D12_TEXTURE_COPY_TYPE_SUBRESOURCE_INDEX,
+    .SubresourceIndex = 0
+    };
+    D3D12_TEXTURE_COPY_LOCATION Src = {
+    .pResource = buffers[stagingBuffer.id - 1].resource.Get(),
+    .Type = D3D12_TEXTURE_COPY_TYPE_PLACED_FOOTPRINT,
+    .PlacedFootprint = Layouts[0]
+    };
+    copyList->CopyTextureRegion(
+        &Dst, 0, 0, 0, &Src, nullptr
+    );
+
+    // - tworzy SRV (widok zasobu shadera) dla tekstury
+    D3D12_SHADER_RESOURCE_VIEW_DESC srv_desc = {
+    .Format = tex_resource_desc.Format,
+    .ViewDimension = D3D12_SRV_DIMENSION_TEXTURE2D,
+    .Shader4ComponentMapping =
+    D3D12_DEFAULT_SHADER_4_COMPONENT_MAPPING,
+    .Texture2D = {
+    .MostDetailedMip = 0,
+    .MipLevels = 1,
+    .PlaneSlice = 0,
+    .ResourceMinLODClamp = 0.0f
+    },
+    };
+    const UINT descriptor = allocateDescriptor();
+    D3D12_CPU_DESCRIPTOR_HANDLE cpu_desc_handle = getStagingDescriptor(descriptor);
+
+    device->CreateShaderResourceView(
+        texture_resource.Get(), &srv_desc, cpu_desc_handle
+    );
+    commitDescriptor(descriptor);
+
+    textures.push_back({ texture_resource, descriptor, texture_allocation, uploads.getBatchFenceValue() });
+    return { static_cast<uint32_t>(textures.size()) };
+}
+
+BufferHandle D3D12Backend::createBuffer(const BufferDesc& desc)
+{
+    Buffer buffer = {};
+    buffer.memory = desc.memory;
+
+    UINT64 size = desc.size;
+    if (desc.usage == BufferUsage::Constant)
+        size = (size + D3D12_CONSTANT_BUFFER_DATA_PLACEMENT_ALIGNMENT - 1)
+            & ~static_cast<UINT64>(D3D12_CONSTANT_BUFFER_DATA_PLACEMENT_ALIGNMENT - 1);
+
+    D3D12_RESOURCE_DESC resourceDesc;
+    resourceDesc.Dimension = D3D12_RESOURCE_DIMENSION_BUFFER;
+    resourceDesc.Alignment = 0;
+    resourceDesc.Width = size;
+    resourceDesc.Height = 1;
+    resourceDesc.DepthOrArraySize = 1;
+    resourceDesc.MipLevels = 1;
+    resourceDesc.Format = DXGI_FORMAT_UNKNOWN;
+    resourceDesc.SampleDesc.Count = 1;
+    resourceDesc.SampleDesc.Quality = 0;
+    resourceDesc.Layout = D3D12_TEXTURE_LAYOUT_ROW_MAJOR;
+    resourceDesc.Flags = D3D12_RESOURCE_FLAG_NONE;
+
+    const D3D12_RESOURCE_STATES initialState = desc.memory == MemoryType::Upload ? D3D12_RESOURCE_STATE_GENERIC_READ
+        : desc.memory == MemoryType::Readback ? D3D12_RESOURCE_STATE_COPY_DEST
+        : D3D12_RESOURCE_STATE_COMMON;
+
+    buffer.resource = createPlacedResource(getBufferHeaps(desc.memory), resourceDesc, initialState, nullptr,
+        buffers.size(), buffer.allocation);
+
+    if (desc.memory == MemoryType::Upload)
+    {
+        CD3DX12_RANGE readRange(0, 0);
+        ThrowIfFailed(buffer.resource->Map(0, &readRange, reinterpret_cast<void**>(&buffer.data)));
+        if (desc.initialData)
+            memcpy(buffer.data, desc.initialData, desc.size);
+    }
+    else if (desc.memory == MemoryType::Default && desc.initialData)
+    {
+        // COMMON is promoted to COPY_DEST by the copy and decays back when the
+        // batch is done; draws then promote it to a vertex or constant buffer.
+        const size_t offset = allocateStaging(desc.size, ConstantBufferAlignment);
+        const Buffer& staging = buffers[stagingBuffer.id - 1];
+        memcpy(staging.data + offset, desc.initialData, desc.size);
+        copyList->CopyBufferRegion(buffer.resource.Get(), 0, staging.resource.Get(), offset, desc.size);
+        buffer.uploadFenceValue = uploads.getBatchFenceValue();
+    }
+
+    if (desc.usage == BufferUsage::Vertex)
+    {
+        buffer.view.BufferLocation = buffer.resource->GetGPUVirtualAddress();
+        buffer.view.StrideInBytes = desc.stride;
+        buffer.view.SizeInBytes = static_cast<UINT>(desc.size);
+    }
+
+    buffers.push_back(buffer);
+    return { static_cast<uint32_t>(buffers.size()) };
+}
+
+bool D3D12Backend::isBufferReady(BufferHandle buffer)
+{
+    return buffers[buffer.id - 1].uploadFenceValue <= copyFence->GetCompletedValue();
+}
+
+bool D3D12Backend::isTextureReady(TextureHandle texture)
+{
+    return textures[texture.id - 1].uploadFenceValue <= copyFence->GetCompletedValue();
+}
+
+void D3D12Backend::flushUploads()
+{
+    uploads.retire(copyFence->GetCompletedValue());
+    if (!copyListOpen)
+        return;
+
+    ThrowIfFailed(copyList->Close());
+    ID3D12CommandList* ppCommandLists[] = { copyList.Get() };
+    copyQueue->ExecuteCommandLists(_countof(ppCommandLists), ppCommandLists);
+    copyListOpen = false;
+
+    const UINT64 value = uploads.submitBatch();
+    ThrowIfFailed(copyQueue->Signal(copyFence.Get(), value));
+    copyAllocators[openCopyAllocator].fenceValue = value;
+}
+
+size_t D3D12Backend::allocateStaging(size_t size, size_t alignment)
+{
+    size_t offset;
+    while (!uploads.allocateStaging(size, alignment, offset))
+    {
+        // Send what is already staged before waiting for older batches.
+        if (uploads.hasOpenBatch())
+        {
+            flushUploads();
+            continue;
+        }
+        if (!uploads.hasPendingBatches())
+            ThrowIfFailed(E_OUTOFMEMORY);
+
+        waitForCopyFenceValue(uploads.getOldestFenceValue());
+    }
+
+    if (!copyListOpen)
+        openCopyList();
+    return offset;
+}
+
+void D3D12Backend::openCopyList()
+{
+    const UINT64 completed = copyFence->GetCompletedValue();
+
+    openCopyAllocator = copyAllocators.size();
+    for (size_t i = 0; i < copyAllocators.size(); i++)
+    {
+        if (copyAllocators[i].fenceValue <= completed)
+        {
+            openCopyAllocator = i;
+            break;
+        }
+    }
+
+    if (openCopyAllocator == copyAllocators.size())
+    {
+        copyAllocators.push_back({});
+        ThrowIfFailed(device->CreateCommandAllocator(D3D12_COMMAND_LIST_TYPE_COPY,
+            IID_PPV_ARGS(&copyAllocators.back().allocator)));
+    }
+
+    CopyAllocator& copyAllocator = copyAllocators[openCopyAllocator];
+    // Not reusable until this batch completes.
+    copyAllocator.fenceValue = UINT64_MAX;
+    ThrowIfFailed(copyAllocator.allocator->Reset());
+    ThrowIfFailed(copyList->Reset(copyAllocator.allocator.Get(), nullptr));
+    copyListOpen = true;
+}
+
+void D3D12Backend::waitForCopyFenceValue(UINT64 value)
+{
+    if (copyFence->GetCompletedValue() < value)
+    {
+        ThrowIfFailed(copyFence->SetEventOnCompletion(value, copyFenceEvent));
+        WaitForSingleObject(copyFenceEvent, INFINITE);
+    }
+
+    uploads.retire(copyFence->GetCompletedValue());
+}
+
+void D3D12Backend::destroyBuffer(BufferHandle handle)
+{
+    Buffer& buffer = buffers[handle.id - 1];
+    if (!buffer.resource)
+        return;
+
+    releaseQueue.release({ buffer.resource, &getBufferHeaps(buffer.memory), buffer.allocation });
+    buffer = Buffer();
+}
+
+D3D12Backend::HeapPool& D3D12Backend::getBufferHeaps(MemoryType memory)
+{
+    return memory == MemoryType::Upload ? uploadBufferHeaps
+        : memory == MemoryType::Readback ? readbackBufferHeaps
+        : defaultBufferHeaps;
+}
+
+ComPtr<ID3D12Resource> D3D12Backend::createPlacedResource(HeapPool& pool, const D3D12_RESOURCE_DESC& desc,
+    D3D12_RESOURCE_STATES state, const D3D12_CLEAR_VALUE* clearValue, uint64_t owner,
+    GpuMemoryPool::Allocation& allocation)
+{
+    const D3D12_RESOURCE_ALLOCATION_INFO info = device->GetResourceAllocationInfo(0, 1, &desc);
+    allocation = pool.allocator.allocate(info.SizeInBytes, info.Alignment, owner);
+    if (!allocation.isValid())
+        ThrowIfFailed(E_OUTOFMEMORY);
+
+    if (pool.heaps.size() <= allocation.page)
+        pool.heaps.resize(allocation.page + 1);
+    if (!pool.heaps[allocation.page])
+    {
+        D3D12_HEAP_DESC heapDesc = {};
+        heapDesc.SizeInBytes = pool.allocator.getPageSize(allocation.page);
+        heapDesc.Properties = CD3DX12_HEAP_PROPERTIES(pool.type);
+        heapDesc.Alignment = D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT;
+        heapDesc.Flags = pool.flags;
+        ThrowIfFailed(device->CreateHeap(&heapDesc, IID_PPV_ARGS(&pool.heaps[allocation.page])));
+    }
+
+    ComPtr<ID3D12Resource> resource;
+    ThrowIfFailed(device->CreatePlacedResource(pool.heaps[allocation.page].Get(), allocation.offset,
+        &desc, state, clearValue, IID_PPV_ARGS(&resource)));
+    return resource;
+}
+
+void D3D12Backend::releaseEmptyHeaps(HeapPool& pool)
+{
+    for (uint32_t page : pool.allocator.releaseEmptyPages())
+        pool.heaps[page].Reset();
+}
+
+void D3D12Backend::freeReleasedObject(ReleasedObject& released)
+{
+    if (released.pool)
+        released.pool->allocator.free(released.allocation);
+}
+
+uint32_t D3D12Backend::defragmentMemory(uint32_t maxMoves)
+{
+    waitForGpu();
+    flushUploads();
+    waitForCopyFenceValue(uploads.getSubmittedFenceValue());
+
+    ID3D12CommandAllocator* commandAllocator = commandAllocators[frameSync.getFrameSlot()].Get();
+    ThrowIfFailed(commandAllocator->Reset());
+    ThrowIfFailed(commandList->Reset(commandAllocator, nullptr));
+
+    std::vector<ComPtr<ID3D12Resource>> oldResources;
+    uint32_t moveCount = 0;
+
+    for (HeapPool* pool : { &uploadBufferHeaps, &defaultBufferHeaps, &readbackBufferHeaps })
+    {
+        for (const GpuMemoryPool::Move& move : pool->allocator.defragment(maxMoves - moveCount))
+        {
+            Buffer& buffer = buffers[move.owner];
+            const D3D12_RESOURCE_DESC desc = buffer.resource->GetDesc();
+            const D3D12_RESOURCE_STATES state = buffer.memory == MemoryType::Upload ? D3D12_RESOURCE_STATE_GENERIC_READ
+                : buffer.memory == MemoryType::Readback ? D3D12_RESOURCE_STATE_COPY_DEST
+                : D3D12_RESOURCE_STATE_COMMON;
+
+            ComPtr<ID3D12Resource> resource;
+            ThrowIfFailed(device->CreatePlacedResource(pool->heaps[move.to.page].Get(), move.to.offset,
+                &desc, state, nullptr, IID_PPV_ARGS(&resource)));
+
+            if (buffer.memory == MemoryType::Default)
+            {
+                // Buffers in COMMON are promoted to the copy states and decay
+                // back once the copy is done.
+                commandList->CopyBufferRegion(resource.Get(), 0, buffer.resource.Get(), 0, desc.Width);
+            }
+            else
+            {
+                // The GPU cannot copy into upload or out of readback heaps.
+                UINT8* source;
+                UINT8* destination;
+                ThrowIfFailed(buffer.resource->Map(0, nullptr, reinterpret_cast<void**>(&source)));
+                ThrowIfFailed(resource->Map(0, nullptr, reinterpret_cast<void**>(&destination)));
+                memcpy(destination, source, static_cast<size_t>(desc.Width));
+                buffer.resource->Unmap(0, nullptr);
+                if (buffer.memory == MemoryType::Upload)
+                    buffer.data = destination;
+                else
+                    resource->Unmap(0, nullptr);
+            }
+
+            oldResources.push_back(buffer.resource);
+            buffer.resource = resource;
+            buffer.allocation = move.to;
+            if (buffer.view.SizeInBytes != 0)
+                buffer.view.BufferLocation = resource->GetGPUVirtualAddress();
+            moveCount++;
+        }
+    }
+
+    ThrowIfFailed(commandList->Close());
+    ID3D12CommandList* ppCommandLists[] = { commandList.Get() };
+    commandQueue->ExecuteCommandLists(_countof(ppCommandLists), ppCommandLists);
+    waitForGpu();
+
+    oldResources.clear();
+    for (HeapPool* pool : { &uploadBufferHeaps, &defaultBufferHeaps, &readbackBufferHeaps })
+        releaseEmptyHeaps(*pool);
+
+    return moveCount;
+}
+
+GpuMemoryPool::Stats D3D12Backend::getMemoryStats() const
+{
+    GpuMemoryPool::Stats stats = {};
+    for (const HeapPool* pool : { &uploadBufferHeaps, &defaultBufferHeaps, &readbackBufferHeaps,
+        &textureHeaps, &targetHeaps })
+        stats.add(pool->allocator.getStats());
+    return stats;
+}
+
+void* D3D12Backend::mapBuffer(BufferHandle buffer)
+{
+    return buffers[buffer.id - 1].data;
+}
+
+CommandRecorder& D3D12Backend::beginBundle()
+{
+    ThrowIfFailed(device->CreateCommandList(0, D3D12_COMMAND_LIST_TYPE_BUNDLE,
+        bundleAllocator.Get(), nullptr, IID_PPV_ARGS(&openBundle)));
+
+    // Bundles inherit bindings but not the topology, and have to use the
+    // same root signature as the list that executes them. They do not set
+    // descriptor heaps, so they stay valid when the descriptor heap grows.
+    openBundle->SetGraphicsRootSignature(rootSignature.Get());
+    openBundle->IASetPrimitiveTopology(D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+
+    bundleRecorder.setCommandList(openBundle.Get());
+    return bundleRecorder;
+}
+
+BundleHandle D3D12Backend::endBundle()
+{
+    ThrowIfFailed(openBundle->Close());
+
+    bundles.push_back(openBundle);
+    openBundle.Reset();
+    return { static_cast<uint32_t>(bundles.size()) };
+}
+
+void D3D12Backend::setFrameState(ID3D12GraphicsCommandList* list)
+{
+    list->SetGraphicsRootSignature(rootSignature.Get());
+
+    ID3D12DescriptorHeap* descHeaps[] = { descriptorHeap.Get() };
+    list->SetDescriptorHeaps(_countof(descHeaps), descHeaps);
+
+    list->RSSetViewports(1, &viewport);
+    list->RSSetScissorRects(1, &scissorRect);
+
+    CD3DX12_CPU_DESCRIPTOR_HANDLE rtvHandle(
+        rtvHeap->GetCPUDescriptorHandleForHeapStart(), frameIndex, rtvDescriptorSize);
+
+    auto dh = depthBufferHeap->GetCPUDescriptorHandleForHeapStart();
+    list->OMSetRenderTargets(1, &rtvHandle, FALSE,
+        &dh);
+
+    list->IASetPrimitiveTopology(D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+
+    // The whole persistent region is one bindless range, bound once.
+    list->SetGraphicsRootDescriptorTable(TexturesParameter, getGpuDescriptor(0));
+    if (shadowCascadeCount > 0)
+        list->SetGraphicsRootDescriptorTable(ShadowMapParameter, getGpuDescriptor(shadowMapDescriptor));
+}
+
+void D3D12Backend::openFrame(UINT variant)
+{
+    if (frameOpen)
+        return;
+
+    if (resizePending)
+        applyResize();
+
+    // present() already waited for the frame that last used this slot.
+    ID3D12CommandAllocator* commandAllocator = commandAllocators[frameSync.getFrameSlot()].Get();
+    ThrowIfFailed(commandAllocator->Reset());
+    ThrowIfFailed(commandList->Reset(commandAllocator, nullptr));
+
+    // The frame that last used the slot is done, so its timestamps are in.
+    const UINT slot = frameSync.getFrameSlot();
+    const UINT64 slotOffset = slot * GpuProfiler::QueriesPerFrame * sizeof(UINT64);
+    ID3D12Resource* readback = buffers[timestampBuffer.id - 1].resource.Get();
+    const CD3DX12_RANGE readRange(slotOffset, slotOffset + GpuProfiler::QueriesPerFrame * sizeof(UINT64));
+    const CD3DX12_RANGE writeRange(0, 0);
+    UINT8* timestamps;
+    ThrowIfFailed(readback->Map(0, &readRange, reinterpret_cast<void**>(&timestamps)));
+    gpuProfiler.collect(slot, reinterpret_cast<const uint64_t*>(timestamps + slotOffset), timestampFrequency);
+    readback->Unmap(0, &writeRange);
+
+    gpuProfiler.beginFrame(slot);
+    writeTimestamp(commandList.Get(), gpuProfiler.beginScope("Frame"));
+    passScopeOpen = false;
+
+    frameOpen = true;
+    // New shadow maps hold garbage until a static pass clears them.
+    frameVariant = shadowCascadeCount > 0 && !shadowMapsCleared ? StaticShadowsFrame : variant;
+    nextPass = 0;
+}
+
+void D3D12Backend::advanceFrame(uint32_t pass)
+{
+    const RenderGraph& graph = getFrameGraph();
+    for (; nextPass <= pass; nextPass++)
+    {
+        if (graph.isPassCulled(nextPass))
+            continue;
+
+        if (passScopeOpen)
+            writeTimestamp(commandList.Get(), gpuProfiler.endScope());
+        writeTimestamp(commandList.Get(), gpuProfiler.beginScope(graph.getPassName(nextPass).c_str()));
+        passScopeOpen = true;
+
+        addBarriers(commandList.Get(), graph.getBarriers(nextPass));
+
+        if (nextPass == staticShadowPass && !shadowMapsCleared)
+        {
+            for (UINT cascade = 0; cascade < shadowCascadeCount; cascade++)
+            {
+                commandList->ClearDepthStencilView(CD3DX12_CPU_DESCRIPTOR_HANDLE(
+                    shadowDsvHeap->GetCPUDescriptorHandleForHeapStart(), cascade, dsvDescriptorSize),
+                    D3D12_CLEAR_FLAG_DEPTH, 1.0f, 0, 0, nullptr);
+            }
+            shadowMapsCleared = true;
+        }
+        if (nextPass == copyShadowPass)
+        {
+            commandList->CopyResource(shadowMaps[static_cast<UINT>(ShadowLayer::Dynamic)].Get(),
+                shadowMaps[static_cast<UINT>(ShadowLayer::Static)].Get());
+        }
+    }
+}
+
+CommandRecorder& D3D12Backend::beginShadowPass(ShadowLayer layer, uint32_t cascade)
+{
+    openFrame(layer == ShadowLayer::Static ? StaticShadowsFrame : DynamicShadowsFrame);
+    advanceFrame(layer == ShadowLayer::Static ? staticShadowPass : dynamicShadowPass);
+    frameDynamicShadows |= layer == ShadowLayer::Dynamic;
+
+    setFrameState(commandList.Get());
+
+    const CD3DX12_CPU_DESCRIPTOR_HANDLE dsvHandle(shadowDsvHeap->GetCPUDescriptorHandleForHeapStart(),
+        static_cast<UINT>(layer) * shadowCascadeCount + cascade, dsvDescriptorSize);
+    if (layer == ShadowLayer::Static)
+        commandList->ClearDepthStencilView(dsvHandle, D3D12_CLEAR_FLAG_DEPTH, 1.0f, 0, 0, nullptr);
+
+    commandList->OMSetRenderTargets(0, nullptr, FALSE, &dsvHandle);
+    commandList->RSSetViewports(1, &shadowViewport);
+
+    recorder.setCommandList(commandList.Get());
+    return recorder;
+}
+
+CommandRecorder& D3D12Backend::beginFrame(const float clearColor[4])
+{
+    openFrame(shadowLayersMatch ? CachedShadowsFrame : DynamicShadowsFrame);
+    advanceFrame(scenePass);
+
+    setFrameState(commandList.Get());
+
+    writeTimestamp(commandList.Get(), gpuProfiler.beginScope("Clear"));
+    CD3DX12_CPU_DESCRIPTOR_HANDLE rtvHandle(
+        rtvHeap->GetCPUDescriptorHandleForHeapStart(), frameIndex, rtvDescriptorSize);
+    commandList->ClearRenderTargetView(rtvHandle, clearColor, 0, nullptr);
+
+    commandList->ClearDepthStencilView(
+        depthBufferHeap->GetCPUDescriptorHandleForHeapStart(), D3D12_CLEAR_FLAG_DEPTH, 1, 0, 0, nullptr);
+    writeTimestamp(commandList.Get(), gpuProfiler.endScope());
+
+    recorder.setCommandList(commandList.Get());
+    return recorder;
+}
+
+// Called from worker threads, each index by one thread only. The device is
+// free-threaded, and nothing here touches state shared between indices.
+CommandRecorder& D3D12Backend::beginParallelRecorder(uint32_t index)
+{
+    ComPtr<ID3D12CommandAllocator>& allocator = parallelAllocators[frameSync.getFrameSlot()][index];
+    if (!allocator)
+    {
+        ThrowIfFailed(device->CreateCommandAllocator(
+            D3D12_COMMAND_LIST_TYPE_DIRECT, IID_PPV_ARGS(&allocator)));
+    }
+    else
+    {
+        ThrowIfFailed(allocator->Reset());
+    }
+
+    if (!parallelLists[index])
+    {
+        ThrowIfFailed(device->CreateCommandList(0, D3D12_COMMAND_LIST_TYPE_DIRECT,
+            allocator.Get(), nullptr, IID_PPV_ARGS(&parallelLists[index])));
+    }
+    else
+    {
+        ThrowIfFailed(parallelLists[index]->Reset(allocator.Get(), nullptr));
+    }
+
+    setFrameState(parallelLists[index].Get());
+    parallelUsed[index] = true;
+
+    parallelRecorders[index].setCommandList(parallelLists[index].Get());
+    return parallelRecorders[index];
+}
+
+void D3D12Backend::submitFrame()
+{
+    PROFILE_ZONE("SubmitFrame");
+    flushUploads();
+
+    ID3D12CommandList* ppCommandLists[MaxParallelRecorders + 2] = { commandList.Get() };
+    UINT listCount = 1;
+
+    for (UINT i = 0; i < MaxParallelRecorders; i++)
+    {
+        if (!parallelUsed[i])
+            continue;
+
+        ThrowIfFailed(parallelLists[i]->Close());
+        ppCommandLists[listCount++] = parallelLists[i].Get();
+        parallelUsed[i] = false;
+    }
+
+    // Without parallel lists the present barrier goes at the end of the
+    // frame's own list, as before.
+    ID3D12GraphicsCommandList* lastList = commandList.Get();
+    if (listCount > 1)
+    {
+        ThrowIfFailed(commandList->Close());
+
+        ID3D12CommandAllocator* closingAllocator = closingAllocators[frameSync.getFrameSlot()].Get();
+        ThrowIfFailed(closingAllocator->Reset());
+        ThrowIfFailed(closingList->Reset(closingAllocator, nullptr));
+        ppCommandLists[listCount++] = closingList.Get();
+        lastList = closingList.Get();
+    }
+
+    // The last pass ends after the parallel lists, which run before this one.
+    if (passScopeOpen)
+        writeTimestamp(lastList, gpuProfiler.endScope());
+    passScopeOpen = false;
+
+    // Present() runs after the list, where timestamps cannot reach; this
+    // only times the transitions to the present state.
+    writeTimestamp(lastList, gpuProfiler.beginScope("FinalBarriers"));
+    addBarriers(lastList, getFrameGraph().getFinalBarriers());
+    writeTimestamp(lastList, gpuProfiler.endScope());
+    writeTimestamp(lastList, gpuProfiler.endScope());
+
+    const UINT firstQuery = gpuProfiler.getFrameFirstQuery();
+    lastList->ResolveQueryData(timestampQueryHeap.Get(), D3D12_QUERY_TYPE_TIMESTAMP, firstQuery,
+        gpuProfiler.getFrameQueryCount(), buffers[timestampBuffer.id - 1].resource.Get(),
+        firstQuery * sizeof(UINT64));
+
+    ThrowIfFailed(lastList->Close());
+
+    PROFILE_ZONE("ExecuteCommandLists");
+    commandQueue->ExecuteCommandLists(listCount, ppCommandLists);
+    frameOpen = false;
+    shadowLayersMatch = !frameDynamicShadows;
+    frameDynamicShadows = false;
+}
+
+void D3D12Backend::present()
+{
+    PROFILE_ZONE("Present");
+    const UINT flags = presentParams.syncInterval == 0 && presentParams.allowTearing && tearingSupported
+        ? DXGI_PRESENT_ALLOW_TEARING : 0;
+    ThrowIfFailed(swapChain->Present(presentParams.syncInterval, flags));
+
+    moveToNextFrame();
+}
+
+void D3D12Backend::waitForPresentSlot()
+{
+    PROFILE_ZONE("WaitForPresentSlot");
+    WaitForSingleObjectEx(frameLatencyWaitableObject, 1000, TRUE);
+}
+
+void D3D12Backend::resize(uint32_t width, uint32_t height)
+{
+    pendingWidth = width;
+    pendingHeight = height;
+    resizePending = true;
+}
+
+void D3D12Backend::applyResize()
+{
+    resizePending = false;
+    if (pendingWidth == width && pendingHeight == height)
+        return;
+
+    width = pendingWidth;
+    height = pendingHeight;
+    viewport = CD3DX12_VIEWPORT(0.0f, 0.0f, static_cast<float>(width), static_cast<float>(height));
+
+    // ResizeBuffers needs every reference to the back buffers gone, the GPU's
+    // included, so this waits for the frames already submitted; unlike
+    // waitForGpu() it queues no signal of its own. The depth buffer and the
+    // rest of the size dependent resources go through the release queue.
+    waitForFenceValue(frameSync.getLastFenceValue());
+    for (UINT i = 0; i < backBufferCount; i++)
+        renderTargets[i].Reset();
+
+    ThrowIfFailed(swapChain->ResizeBuffers(backBufferCount, width, height, DXGI_FORMAT_UNKNOWN, swapChainFlags));
+    frameIndex = swapChain->GetCurrentBackBufferIndex();
+
+    createRenderTargets();
+    createDepthBuffer();
+}
+
+void D3D12Backend::destroy()
+{
+    waitForGpu();
+    flushUploads();
+    waitForCopyFenceValue(uploads.getSubmittedFenceValue());
+    releaseQueue.flush(freeReleasedObject);
+
+    // Pipelines still queued are not compiled, and not stored either.
+    pipelines.reset();
+    savePipelineLibrary();
+
+    CloseHandle(fenceEvent);
+    CloseHandle(copyFenceEvent);
+    CloseHandle(frameLatencyWaitableObject);
+}
+
+// Drains the queue, for the rare cases that really need an idle GPU.
+void D3D12Backend::waitForGpu()
+{
+    const UINT64 value = frameSync.nextFenceValue();
+    ThrowIfFailed(commandQueue->Signal(fence.Get(), value));
+
+    waitForFenceValue(value);
+
+    frameIndex = swapChain->GetCurrentBackBufferIndex();
+}
+
+// Marks the end of the frame and only blocks if the next slot's previous
+// frame is still on the GPU.
+void D3D12Backend::moveToNextFrame()
+{
+    const UINT64 value = frameSync.endFrame();
+    ThrowIfFailed(commandQueue->Signal(fence.Get(), value));
+    uploadRing.finishFrame(value);
+    descriptors.finishFrame(value);
+    releaseQueue.finishFrame(value);
+
+    frameIndex = swapChain->GetCurrentBackBufferIndex();
+
+    waitForFenceValue(frameSync.getSlotFenceValue());
+}
+
+void D3D12Backend::waitForFenceValue(UINT64 value)
+{
+    if (fence->GetCompletedValue() < value)
+    {
+        PROFILE_ZONE("WaitForFence");
+        ThrowIfFailed(fence->SetEventOnCompletion(value, fenceEvent));
+        WaitForSingleObject(fenceEvent, INFINITE);
+    }
+
+    const UINT64 completed = fence->GetCompletedValue();
+    uploadRing.retire(completed);
+    descriptors.retire(completed);
+    releaseQueue.retire(completed, freeReleasedObject);
+}
+
+UploadAllocation D3D12Backend::allocateUpload(size_t size, size_t alignment)
+{
+    size_t offset;
+    while (!uploadRing.allocate(size, alignment, offset))
+    {
+        // Only the current frame is left, it asked for more than the ring has.
+        if (!uploadRing.hasPendingFrames())
+            ThrowIfFailed(E_OUTOFMEMORY);
+
+        waitForFenceValue(uploadRing.getOldestFenceValue());
+    }
+
+    return { uploadBuffer, offset, buffers[uploadBuffer.id - 1].data + offset };
+}
+
+void D3D12Backend::createCommandQueue()
+{
+    D3D12_COMMAND_QUEUE_DESC queueDesc = {};
+    queueDesc.Flags = D3D12_COMMAND_QUEUE_FLAG_NONE;
+    queueDesc.Type = D3D12_COMMAND_LIST_TYPE_DIRECT;
+
+    ThrowIfFailed(device->CreateCommandQueue(&queueDesc, IID_PPV_ARGS(&commandQueue)));
+}
+
+void D3D12Backend::createSwapChain(ComPtr<IDXGIFactory7> factory)
+{
+    DXGI_SWAP_CHAIN_DESC1 swapChainDesc = {};
+    swapChainDesc.BufferCount = backBufferCount;
+    swapChainDesc.Width = 0;
+    swapChainDesc.Height = 0;
+    swapChainDesc.Format = DXGI_FORMAT_R8G8B8A8_UNORM;
+    swapChainDesc.BufferUsage = DXGI_USAGE_RENDER_TARGET_OUTPUT;
+    swapChainDesc.SwapEffect = DXGI_SWAP_EFFECT_FLIP_DISCARD;
+    swapChainDesc.SampleDesc.Count = 1;
+
+    BOOL allowTearing = FALSE;
+    if (SUCCEEDED(factory->CheckFeatureSupport(DXGI_FEATURE_PRESENT_ALLOW_TEARING,
+        &allowTearing, sizeof(allowTearing))))
+    {
+        tearingSupported = allowTearing == TRUE;
+    }
+    swapChainFlags = DXGI_SWAP_CHAIN_FLAG_FRAME_LATENCY_WAITABLE_OBJECT;
+    if (tearingSupported)
+        swapChainFlags |= DXGI_SWAP_CHAIN_FLAG_ALLOW_TEARING;
+    swapChainDesc.Flags = swapChainFlags;
+
+    ComPtr<IDXGISwapChain1> swapChainTmp;
+    ThrowIfFailed(factory->CreateSwapChainForHwnd(
+        commandQueue.Get(),
+        WinApp::GetHwnd(),
+        &swapChainDesc,
+        nullptr,
+        nullptr,
+        &swapChainTmp
+    ));
+
+    ThrowIfFailed(factory->MakeWindowAssociation(WinApp::GetHwnd(), DXGI_MWA_NO_ALT_ENTER));
+
+    ThrowIfFailed(swapChainTmp.As(&swapChain));
+    frameIndex = swapChain->GetCurrentBackBufferIndex();
+
+    ThrowIfFailed(swapChain->SetMaximumFrameLatency(1));
+    frameLatencyWaitableObject = swapChain->GetFrameLatencyWaitableObject();
+}
+
+void D3D12Backend::createHeaps()
+{
+    // render target view (RTV) descriptor heap.
+    {
+        D3D12_DESCRIPTOR_HEAP_DESC rtvHeapDesc = {};
+        rtvHeapDesc.NumDescriptors = backBufferCount;
+        rtvHeapDesc.Type = D3D12_DESCRIPTOR_HEAP_TYPE_RTV;
+        rtvHeapDesc.Flags = D3D12_DESCRIPTOR_HEAP_FLAG_NONE;
+        ThrowIfFailed(device->CreateDescriptorHeap(&rtvHeapDesc, IID_PPV_ARGS(&rtvHeap)));
+
+        rtvDescriptorSize = device->GetDescriptorHandleIncrementSize(D3D12_DESCRIPTOR_HEAP_TYPE_RTV);
+    }
+
+    // Shader resource views.
+    {
+        cbvSrvDescriptorSize = device->GetDescriptorHandleIncrementSize(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
+
+        descriptors.init(InitialDescriptorCount, TransientDescriptorCount);
+        descriptorGeneration = descriptors.getGeneration();
+        createDescriptorHeaps();
+    }
+
+    // Depth buffer.
+    {
+        D3D12_DESCRIPTOR_HEAP_DESC heapDesc = {};
+        heapDesc.NumDescriptors = 1;
+        heapDesc.Type = D3D12_DESCRIPTOR_HEAP_TYPE_DSV;
+        heapDesc.NodeMask = 0;
+        ThrowIfFailed(device->CreateDescriptorHeap(&heapDesc, IID_PPV_ARGS(&depthBufferHeap)));
+    }
+}
+
+void D3D12Backend::createRenderTargets()
+{
+    CD3DX12_CPU_DESCRIPTOR_HANDLE rtvHandle(rtvHeap->GetCPUDescriptorHandleForHeapStart());
+
+    for (UINT i = 0; i < backBufferCount; i++)
+    {
+        ThrowIfFailed(swapChain->GetBuffer(i, IID_PPV_ARGS(&renderTargets[i])));
+        device->CreateRenderTargetView(renderTargets[i].Get(), nullptr, rtvHandle);
+        rtvHandle.Offset(1, rtvDescriptorSize);
+    }
+}
+
+void D3D12Backend::createCommandAllocators()
+{
+    for (UINT i = 0; i < frameSync.getFramesInFlight(); i++)
+    {
+        ThrowIfFailed(device->CreateCommandAllocator(
+            D3D12_COMMAND_LIST_TYPE_DIRECT, IID_PPV_ARGS(&commandAllocators[i])));
+        ThrowIfFailed(device->CreateCommandAllocator(
+            D3D12_COMMAND_LIST_TYPE_DIRECT, IID_PPV_ARGS(&closingAllocators[i])));
+    }
+
+    ThrowIfFailed(device->CreateCommandAllocator(
+        D3D12_COMMAND_LIST_TYPE_BUNDLE, IID_PPV_ARGS(&bundleAllocator)));
+}
+
+void D3D12Backend::createRootSignature()
+{
+    // Unbounded, so every texture in the heap is reachable through one table;
+    // needs resource binding tier 2.
+    D3D12_DESCRIPTOR_RANGE descriptorRanges[] = {
+        {
+            .RangeType = D3D12_DESCRIPTOR_RANGE_TYPE_SRV,
+            .NumDescriptors = UINT_MAX,
+            .BaseShaderRegister = 0,
+            .RegisterSpace = 1,
+            .OffsetInDescriptorsFromTableStart = 0
+        },
+        // Texture2DArray of the dynamic shadow layers.
+        {
+            .RangeType = D3D12_DESCRIPTOR_RANGE_TYPE_SRV,
+            .NumDescriptors = 1,
+            .BaseShaderRegister = 2,
+            .RegisterSpace = 0,
+            .OffsetInDescriptorsFromTableStart = 0
+        }
+    };
+
+    D3D12_ROOT_PARAMETER rootParameters[] = {
+        // Root CBV, so every frame slot can point at its own constant region
+        // without a descriptor per slot.
+        {
+            .ParameterType =
+            D3D12_ROOT_PARAMETER_TYPE_CBV,
+            .Descriptor = {.ShaderRegister = 0, .RegisterSpace = 0 },
+            .ShaderVisibility = D3D12_SHADER_VISIBILITY_ALL
+        },
+        // Material and object ID of the draw.
+        {
+            .ParameterType =
+            D3D12_ROOT_PARAMETER_TYPE_32BIT_CONSTANTS,
+            .Constants = {.ShaderRegister = 1, .RegisterSpace = 0, .Num32BitValues = 2 },
+            .ShaderVisibility = D3D12_SHADER_VISIBILITY_ALL
+        },
+        // StructuredBuffer of material parameters.
+        {
+            .ParameterType =
+            D3D12_ROOT_PARAMETER_TYPE_SRV,
+            .Descriptor = {.ShaderRegister = 0, .RegisterSpace = 0 },
+            .ShaderVisibility = D3D12_SHADER_VISIBILITY_ALL
+        },
+        {
+            .ParameterType =
+            D3D12_ROOT_PARAMETER_TYPE_DESCRIPTOR_TABLE,
+            .DescriptorTable = { 1, &descriptorRanges[0]},
+            .ShaderVisibility = D3D12_SHADER_VISIBILITY_PIXEL
+        },
+        // StructuredBuffer of object world matrices.
+        {
+            .ParameterType =
+            D3D12_ROOT_PARAMETER_TYPE_SRV,
+            .Descriptor = {.ShaderRegister = 1, .RegisterSpace = 0 },
+            .ShaderVisibility = D3D12_SHADER_VISIBILITY_VERTEX
+        },
+        {
+            .ParameterType =
+            D3D12_ROOT_PARAMETER_TYPE_DESCRIPTOR_TABLE,
+            .DescriptorTable = { 1, &descriptorRanges[1]},
+            .ShaderVisibility = D3D12_SHADER_VISIBILITY_PIXEL
+        }
+    };
+
+    D3D12_STATIC_SAMPLER_DESC tex_sampler_desc = {
+        .Filter = D3D12_FILTER_MIN_MAG_MIP_LINEAR,
+        //D3D12_FILTER_MIN_MAG_MIP_POINT, D3D12_FILTER_ANISOTROPIC
+        .AddressU = D3D12_TEXTURE_ADDRESS_MODE_WRAP,
+        //_MODE_MIRROR, _MODE_CLAMP, _MODE_BORDER
+        .AddressV = D3D12_TEXTURE_ADDRESS_MODE_WRAP,
+        .AddressW = D3D12_TEXTURE_ADDRESS_MODE_WRAP,
+        .MipLODBias = 0,
+        .MaxAnisotropy = 0,
+        .ComparisonFunc = D3D12_COMPARISON_FUNC_NEVER,
+        .BorderColor = D3D12_STATIC_BORDER_COLOR_TRANSPARENT_BLACK,
+        .MinLOD = 0.0f,
+        .MaxLOD = D3D12_FLOAT32_MAX,
+        .ShaderRegister = 0,
+        .RegisterSpace = 0,
+        .ShaderVisibility = D3D12_SHADER_VISIBILITY_PIXEL
+    };
+
+    // Hardware 2x2 PCF for the shadow maps; outside a cascade nothing is
+    // shadowed.
+    D3D12_STATIC_SAMPLER_DESC shadowSamplerDesc = {
+        .Filter = D3D12_FILTER_COMPARISON_MIN_MAG_LINEAR_MIP_POINT,
+        .AddressU = D3D12_TEXTURE_ADDRESS_MODE_BORDER,
+        .AddressV = D3D12_TEXTURE_ADDRESS_MODE_BORDER,
+        .AddressW = D3D12_TEXTURE_ADDRESS_MODE_BORDER,
+        .MipLODBias = 0,
+        .MaxAnisotropy = 0,
+        .ComparisonFunc = D3D12_COMPARISON_FUNC_LESS_EQUAL,
+        .BorderColor = D3D12_STATIC_BORDER_COLOR_OPAQUE_WHITE,
+        .MinLOD = 0.0f,
+        .MaxLOD = D3D12_FLOAT32_MAX,
+        .ShaderRegister = 1,
+        .RegisterSpace = 0,
+        .ShaderVisibility = D3D12_SHADER_VISIBILITY_PIXEL
+    };
+
+    const D3D12_STATIC_SAMPLER_DESC samplerDescs[] = { tex_sampler_desc, shadowSamplerDesc };
+
+    D3D12_ROOT_SIGNATURE_DESC rootSignatureDesc = {
+        .NumParameters = _countof(rootParameters),
+        .pParameters = rootParameters,
+        .NumStaticSamplers = _countof(samplerDescs),
+        .pStaticSamplers = samplerDescs,
+        .Flags =
+        D3D12_ROOT_SIGNATURE_FLAG_ALLOW_INPUT_ASSEMBLER_INPUT_LAYOUT |
+        D3D12_ROOT_SIGNATURE_FLAG_DENY_HULL_SHADER_ROOT_ACCESS |
+        D3D12_ROOT_SIGNATURE_FLAG_DENY_DOMAIN_SHADER_ROOT_ACCESS |
+        D3D12_ROOT_SIGNATURE_FLAG_DENY_GEOMETRY_SHADER_ROOT_ACCESS
+    };
+
+    ComPtr<ID3DBlob> signature;
+    ComPtr<ID3DBlob> error;
+    ThrowIfFailed(D3D12SerializeRootSignature(
+        &rootSignatureDesc, D3D_ROOT_SIGNATURE_VERSION_1, &signature, &error));
+    ThrowIfFailed(device->CreateRootSignature(0, signature->GetBufferPointer(),
+        signature->GetBufferSize(), IID_PPV_ARGS(&rootSignature)));
+}
+
+void D3D12Backend::createCommandSignature()
+{
+    D3D12_INDIRECT_ARGUMENT_DESC arguments[2] = {};
+    arguments[0].Type = D3D12_INDIRECT_ARGUMENT_TYPE_CONSTANT;
+    arguments[0].Constant.RootParameterIndex = DrawConstantsParameter;
+    arguments[0].Constant.DestOffsetIn32BitValues = 0;
+    arguments[0].Constant.Num32BitValuesToSet = 2;
+    arguments[1].Type = D3D12_INDIRECT_ARGUMENT_TYPE_DRAW;
+
+    const D3D12_COMMAND_SIGNATURE_DESC commandSignatureDesc = {
+        .ByteStride = sizeof(IndirectDrawCommand),
+        .NumArgumentDescs = _countof(arguments),
+        .pArgumentDescs = arguments,
+        .NodeMask = 0
+    };
+
+    // Changing root constants needs the root signature.
+    ThrowIfFailed(device->CreateCommandSignature(&commandSignatureDesc, rootSignature.Get(),
+        IID_PPV_ARGS(&drawCommandSignature)));
+}
+
+void D3D12Backend::createPipelineCache()
+{
+    // A library written by another driver or for another adapter is
+    // rejected; it then starts out empty and is rewritten on exit.
+    ComPtr<ID3D12Device1> device1;
+    if (SUCCEEDED(device.As(&device1)))
+    {
+        std::ifstream file(PipelineLibraryPath, std::ios::binary);
+        pipelineLibraryData.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+        if (pipelineLibraryData.empty() || FAILED(device1->CreatePipelineLibrary(pipelineLibraryData.data(),
+            pipelineLibraryData.size(), IID_PPV_ARGS(&pipelineLibrary))))
+        {
+            pipelineLibraryData.clear();
+            if (FAILED(device1->CreatePipelineLibrary(nullptr, 0, IID_PPV_ARGS(&pipelineLibrary))))
+                pipelineLibrary.Reset();
+        }
+    }
+
+    uint64_t seed = PipelineHashBasis;
+    for (const D3D12_SHADER_BYTECODE& shader : vertexShaders)
+        seed = hashBytes(shader.pShaderBytecode, shader.BytecodeLength, seed);
+    for (const D3D12_SHADER_BYTECODE& shader : pixelShaders)
+        seed = hashBytes(shader.pShaderBytecode, shader.BytecodeLength, seed);
+
+    pipelines = std::make_unique<PipelineCache<ComPtr<ID3D12PipelineState>>>(PipelineCompileThreads,
+        [this](const PipelineDesc& desc, uint64_t hash) { return compilePipeline(desc, hash); }, seed);
+}
+
+void D3D12Backend::savePipelineLibrary()
+{
+    if (!pipelineLibrary || !pipelineLibraryChanged)
+        return;
+
+    std::vector<char> data(pipelineLibrary->GetSerializedSize());
+    ThrowIfFailed(pipelineLibrary->Serialize(data.data(), data.size()));
+
+    std::ofstream file(PipelineLibraryPath, std::ios::binary | std::ios::trunc);
+    file.write(data.data(), static_cast<std::streamsize>(data.size()));
+}
+
+PipelineHandle D3D12Backend::createPipeline(const PipelineDesc& desc)
+{
+    return { pipelines->request(desc) + 1 };
+}
+
+ComPtr<ID3D12PipelineState> D3D12Backend::compilePipeline(const PipelineDesc& desc, uint64_t hash)
+{
+    D3D12_INPUT_ELEMENT_DESC inputElementDescs[] =
+    {
+        { "POSITION", 0, DXGI_FORMAT_R32G32B32_FLOAT, 0, D3D12_APPEND_ALIGNED_ELEMENT,
+            D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0 },
+        { "NORMAL", 0, DXGI_FORMAT_R32G32B32_FLOAT, 0, D3D12_APPEND_ALIGNED_ELEMENT,
+            D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0 },
+        { "COLOR", 0, DXGI_FORMAT_R32G32B32A32_FLOAT, 0, D3D12_APPEND_ALIGNED_ELEMENT,
+            D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0 },
+        { "TEXCOORD", 0, DXGI_FORMAT_R32G32_FLOAT, 0, D3D12_APPEND_ALIGNED_ELEMENT, 
+            D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0 },
+        // InstanceData, only used by SceneInstanced.
+        { "WORLD", 0, DXGI_FORMAT_R32G32B32A32_FLOAT, 1, D3D12_APPEND_ALIGNED_ELEMENT,
+            D3D12_INPUT_CLASSIFICATION_PER_INSTANCE_DATA, 1 },
+        { "WORLD", 1, DXGI_FORMAT_R32G32B32A32_FLOAT, 1, D3D12_APPEND_ALIGNED_ELEMENT,
+            D3D12_INPUT_CLASSIFICATION_PER_INSTANCE_DATA, 1 },
+        { "WORLD", 2, DXGI_FORMAT_R32G32B32A32_FLOAT, 1, D3D12_APPEND_ALIGNED_ELEMENT,
+            D3D12_INPUT_CLASSIFICATION_PER_INSTANCE_DATA, 1 },
+        { "TINT", 0, DXGI_FORMAT_R8G8B8A8_UNORM, 1, D3D12_APPEND_ALIGNED_ELEMENT,
+            D3D12_INPUT_CLASSIFICATION_PER_INSTANCE_DATA, 1 },
+        { "INSTANCELIT", 0, DXGI_FORMAT_R32_UINT, 1, D3D12_APPEND_ALIGNED_ELEMENT,
+            D3D12_INPUT_CLASSIFICATION_PER_INSTANCE_DATA, 1 }
+    };
+    const bool instanced = desc.program == ShaderProgram::SceneInstanced;
+    const UINT perVertexElementCount = 5;
+
+    D3D12_RENDER_TARGET_BLEND_DESC renderTargetBlendDesc;
+    renderTargetBlendDesc.BlendEnable = FALSE;
+    renderTargetBlendDesc.LogicOpEnable = FALSE;
+    renderTargetBlendDesc.SrcBlend = D3D12_BLEND_ONE;
+    renderTargetBlendDesc.DestBlend = D3D12_BLEND_ZERO;
+    renderTargetBlendDesc.BlendOp = D3D12_BLEND_OP_ADD;
+    renderTargetBlendDesc.SrcBlendAlpha = D3D12_BLEND_ONE;
+    renderTargetBlendDesc.DestBlendAlpha = D3D12_BLEND_ZERO;
+    renderTargetBlendDesc.BlendOpAlpha = D3D12_BLEND_OP_ADD;
+    renderTargetBlendDesc.LogicOp = D3D12_LOGIC_OP_NOOP;
+    renderTargetBlendDesc.RenderTargetWriteMask = D3D12_COLOR_WRITE_ENABLE_ALL;
+
+    D3D12_BLEND_DESC blendStateDesc;
+    blendStateDesc.AlphaToCoverageEnable = FALSE;
+    blendStateDesc.IndependentBlendEnable = FALSE;
+    blendStateDesc.RenderTarget[0] = renderTargetBlendDesc;
+
+    D3D12_RASTERIZER_DESC rasterizerDesc;
+    rasterizerDesc.FillMode = D3D12_FILL_MODE_SOLID;
+    rasterizerDesc.CullMode = desc.cullBackFaces ? D3D12_CULL_MODE_BACK : D3D12_CULL_MODE_NONE;
+    rasterizerDesc.FrontCounterClockwise = FALSE;
+    rasterizerDesc.DepthBias = desc.shadowCaster ? 100 : D3D12_DEFAULT_DEPTH_BIAS;
+    rasterizerDesc.DepthBiasClamp = D3D12_DEFAULT_DEPTH_BIAS_CLAMP;
+    rasterizerDesc.SlopeScaledDepthBias = desc.shadowCaster ? 2.0f : D3D12_DEFAULT_SLOPE_SCALED_DEPTH_BIAS;
+    rasterizerDesc.DepthClipEnable = desc.shadowCaster ? FALSE : TRUE;
+    rasterizerDesc.MultisampleEnable = FALSE;
+    rasterizerDesc.AntialiasedLineEnable = FALSE;
+    rasterizerDesc.ForcedSampleCount = 0;
+    rasterizerDesc.ConservativeRaster = D3D12_CONSERVATIVE_RASTERIZATION_MODE_OFF;
+
+    D3D12_DEPTH_STENCIL_DESC depthStencilDesc;
+    depthStencilDesc.DepthEnable = desc.depthTest ? TRUE : FALSE;
+    depthStencilDesc.DepthWriteMask = desc.depthWrite ? D3D12_DEPTH_WRITE_MASK_ALL : D3D12_DEPTH_WRITE_MASK_ZERO;
+    depthStencilDesc.DepthFunc = D3D12_COMPARISON_FUNC_LESS;
+    depthStencilDesc.StencilEnable = FALSE;
+    depthStencilDesc.StencilReadMask = D3D12_DEFAULT_STENCIL_READ_MASK;
+    depthStencilDesc.StencilWriteMask = D3D12_DEFAULT_STENCIL_READ_MASK;
+    depthStencilDesc.FrontFace.StencilFailOp = D3D12_STENCIL_OP_KEEP;
+    depthStencilDesc.FrontFace.StencilDepthFailOp = D3D12_STENCIL_OP_KEEP;
+    depthStencilDesc.FrontFace.StencilPassOp = D3D12_STENCIL_OP_KEEP;
+    depthStencilDesc.FrontFace.StencilFunc = D3D12_COMPARISON_FUNC_ALWAYS;
+    depthStencilDesc.BackFace.StencilFailOp = D3D12_STENCIL_OP_KEEP;
+    depthStencilDesc.BackFace.StencilDepthFailOp = D3D12_STENCIL_OP_KEEP;
+    depthStencilDesc.BackFace.StencilPassOp = D3D12_STENCIL_OP_KEEP;
+    depthStencilDesc.BackFace.StencilFunc = D3D12_COMPARISON_FUNC_ALWAYS;
+
+
+    D3D12_GRAPHICS_PIPELINE_STATE_DESC psoDesc = {};
+    psoDesc.InputLayout = { inputElementDescs, instanced ? _countof(inputElementDescs) : perVertexElementCount };
+    psoDesc.pRootSignature = rootSignature.Get();
+    const uint32_t permutation = getShaderPermutation(desc);
+    psoDesc.VS = vertexShaders[permutation];
+    psoDesc.PS = desc.shadowCaster ? D3D12_SHADER_BYTECODE{} : pixelShaders[permutation & ~ShaderFeatureInstanced];
+    psoDesc.RasterizerState = rasterizerDesc;
+    psoDesc.BlendState = blendStateDesc;
+    psoDesc.DepthStencilState = depthStencilDesc;
+    psoDesc.SampleMask = UINT_MAX;
+    psoDesc.IBStripCutValue = D3D12_INDEX_BUFFER_STRIP_CUT_VALUE_DISABLED;
+    psoDesc.PrimitiveTopologyType = D3D12_PRIMITIVE_TOPOLOGY_TYPE_TRIANGLE;
+    psoDesc.NumRenderTargets = desc.shadowCaster ? 0 : 1;
+    psoDesc.RTVFormats[0] = desc.shadowCaster ? DXGI_FORMAT_UNKNOWN : DXGI_FORMAT_R8G8B8A8_UNORM;
+    psoDesc.DSVFormat = DXGI_FORMAT_D32_FLOAT;
+    psoDesc.SampleDesc.Count = 1;
+    psoDesc.SampleDesc.Quality = 0;
+
+    // Library entries are named by the hash. One whose description does not
+    // match any more, e.g. after a root signature change, is compiled anew
+    // and not stored again.
+    wchar_t name[17];
+    swprintf(name, 17, L"%016llx", static_cast<unsigned long long>(hash));
+
+    ComPtr<ID3D12PipelineState> pipelineState;
+    if (pipelineLibrary && SUCCEEDED(pipelineLibrary->LoadGraphicsPipeline(name, &psoDesc, IID_PPV_ARGS(&pipelineState))))
+        return pipelineState;
+
+    ThrowIfFailed(device->CreateGraphicsPipelineState(&psoDesc, IID_PPV_ARGS(&pipelineState)));
+    if (pipelineLibrary && SUCCEEDED(pipelineLibrary->StorePipeline(name, pipelineState.Get())))
+        pipelineLibraryChanged = true;
+    return pipelineState;
+}
+
+void D3D12Backend::createCommandList()
+{
+    ThrowIfFailed(device->CreateCommandList(0, D3D12_COMMAND_LIST_TYPE_DIRECT,
+        commandAllocators[0].Get(), nullptr, IID_PPV_ARGS(&commandList)));
+    ThrowIfFailed(commandList->Close());
+
+    ThrowIfFailed(device->CreateCommandList(0, D3D12_COMMAND_LIST_TYPE_DIRECT,
+        closingAllocators[0].Get(), nullptr, IID_PPV_ARGS(&closingList)));
+    ThrowIfFailed(closingList->Close());
+}
+
+void D3D12Backend::createFence()
+{
+    ThrowIfFailed(device->CreateFence(0, D3D12_FENCE_FLAG_NONE, IID_PPV_ARGS(&fence)));
+
+    fenceEvent = CreateEvent(nullptr, FALSE, FALSE, nullptr);
+    if (fenceEvent == nullptr)
+        ThrowIfFailed(HRESULT_FROM_WIN32(GetLastError()));
+
+    waitForGpu();
+}
+
+void D3D12Backend::createUploadRing()
+{
+    BufferDesc desc;
+    desc.size = UploadRingSize;
+    desc.usage = BufferUsage::Constant;
+    desc.memory = MemoryType::Upload;
+    uploadBuffer = createBuffer(desc);
+
+    uploadRing.init(UploadRingSize);
+}
+
+void D3D12Backend::createTimestampQueries()
+{
+    D3D12_QUERY_HEAP_DESC queryHeapDesc = {};
+    queryHeapDesc.Type = D3D12_QUERY_HEAP_TYPE_TIMESTAMP;
+    queryHeapDesc.Count = gpuProfiler.getQueryCount();
+    ThrowIfFailed(device->CreateQueryHeap(&queryHeapDesc, IID_PPV_ARGS(&timestampQueryHeap)));
+
+    BufferDesc desc;
+    desc.size = gpuProfiler.getQueryCount() * sizeof(UINT64);
+    desc.memory = MemoryType::Readback;
+    timestampBuffer = createBuffer(desc);
+
+    ThrowIfFailed(commandQueue->GetTimestampFrequency(&timestampFrequency));
+}
+
+void D3D12Backend::writeTimestamp(ID3D12GraphicsCommandList* list, uint32_t query)
+{
+    if (query != GpuProfiler::InvalidQuery)
+        list->EndQuery(timestampQueryHeap.Get(), D3D12_QUERY_TYPE_TIMESTAMP, query);
+}
+
+void D3D12Backend::createCopyQueue()
+{
+    D3D12_COMMAND_QUEUE_DESC queueDesc = {};
+    queueDesc.Flags = D3D12_COMMAND_QUEUE_FLAG_NONE;
+    queueDesc.Type = D3D12_COMMAND_LIST_TYPE_COPY;
+    ThrowIfFailed(device->CreateCommandQueue(&queueDesc, IID_PPV_ARGS(&copyQueue)));
+
+    copyAllocators.push_back({});
+    ThrowIfFailed(device->CreateCommandAllocator(D3D12_COMMAND_LIST_TYPE_COPY,
+        IID_PPV_ARGS(&copyAllocators.back().allocator)));
+    ThrowIfFailed(device->CreateCommandList(0, D3D12_COMMAND_LIST_TYPE_COPY,
+        copyAllocators.back().allocator.Get(), nullptr, IID_PPV_ARGS(&copyList)));
+    ThrowIfFailed(copyList->Close());
+
+    ThrowIfFailed(device->CreateFence(0, D3D12_FENCE_FLAG_NONE, IID_PPV_ARGS(&copyFence)));
+    copyFenceEvent = CreateEvent(nullptr, FALSE, FALSE, nullptr);
+    if (copyFenceEvent == nullptr)
+        ThrowIfFailed(HRESULT_FROM_WIN32(GetLastError()));
+
+    BufferDesc desc;
+    desc.size = UploadStagingSize;
+    desc.memory = MemoryType::Upload;
+    stagingBuffer = createBuffer(desc);
+
+    uploads.init(UploadStagingSize);
+}
+
+void D3D12Backend::createDepthBuffer()
+{
+    D3D12_RESOURCE_DESC resourceDesc;
+    resourceDesc.Dimension = D3D12_RESOURCE_DIMENSION_TEXTURE2D;
+    resourceDesc.Alignment = 0;
+    resourceDesc.Width = width;
+    resourceDesc.Height = height;
+    resourceDesc.DepthOrArraySize = 1;
+    resourceDesc.MipLevels = 0;
+    resourceDesc.Format = DXGI_FORMAT_D32_FLOAT;
+    resourceDesc.SampleDesc.Count = 1;
+    resourceDesc.SampleDesc.Quality = 0;
+    resourceDesc.Layout = D3D12_TEXTURE_LAYOUT_UNKNOWN;
+    resourceDesc.Flags = D3D12_RESOURCE_FLAG_ALLOW_DEPTH_STENCIL;
+
+    D3D12_CLEAR_VALUE clearValue;
+    clearValue.Format = DXGI_FORMAT_D32_FLOAT;
+    clearValue.DepthStencil.Depth = 1.0f;
+    clearValue.DepthStencil.Stencil = 0;
+
+    D3D12_DEPTH_STENCIL_VIEW_DESC depthViewDesc;
+    depthViewDesc.Format = DXGI_FORMAT_D32_FLOAT;
+    depthViewDesc.ViewDimension = D3D12_DSV_DIMENSION_TEXTURE2D;
+    depthViewDesc.Flags = D3D12_DSV_FLAG_NONE;
+    depthViewDesc.Texture2D = {};
+
+    // Resizing replaces the depth buffer; frames in flight may still use the
+    // old one, so it and its place in the pool are released later.
+    if (depthBuffer)
+        releaseQueue.release({ depthBuffer, &targetHeaps, depthBufferAllocation });
+    depthBuffer = createPlacedResource(targetHeaps, resourceDesc, D3D12_RESOURCE_STATE_DEPTH_WRITE,
+        &clearValue, 0, depthBufferAllocation);
+
+    device->CreateDepthStencilView(depthBuffer.Get(), &depthViewDesc,
+        depthBufferHeap->GetCPUDescriptorHandleForHeapStart());
+}
+
+void D3D12Backend::createShadowMaps(uint32_t size, uint32_t cascadeCount)
+{
+    shadowCascadeCount = cascadeCount;
+    shadowViewport = CD3DX12_VIEWPORT(0.0f, 0.0f, static_cast<float>(size), static_cast<float>(size));
+
+    D3D12_DESCRIPTOR_HEAP_DESC heapDesc = {};
+    heapDesc.NumDescriptors = 2 * cascadeCount;
+    heapDesc.Type = D3D12_DESCRIPTOR_HEAP_TYPE_DSV;
+    heapDesc.NodeMask = 0;
+    ThrowIfFailed(device->CreateDescriptorHeap(&heapDesc, IID_PPV_ARGS(&shadowDsvHeap)));
+    dsvDescriptorSize = device->GetDescriptorHandleIncrementSize(D3D12_DESCRIPTOR_HEAP_TYPE_DSV);
+
+    // Typeless, so the slices are written as D32 and sampled as R32.
+    const D3D12_RESOURCE_DESC resourceDesc = CD3DX12_RESOURCE_DESC::Tex2D(DXGI_FORMAT_R32_TYPELESS,
+        size, size, static_cast<UINT16>(cascadeCount), 1, 1, 0, D3D12_RESOURCE_FLAG_ALLOW_DEPTH_STENCIL);
+    const CD3DX12_CLEAR_VALUE clearValue(DXGI_FORMAT_D32_FLOAT, 1.0f, 0);
+    // The states the frame graph imports them in.
+    const D3D12_RESOURCE_STATES states[2] = {
+        D3D12_RESOURCE_STATE_COPY_SOURCE, D3D12_RESOURCE_STATE_ALL_SHADER_RESOURCE };
+
+    for (UINT layer = 0; layer < 2; layer++)
+    {
+        shadowMaps[layer] = createPlacedResource(targetHeaps, resourceDesc, states[layer], &clearValue, 0,
+            shadowMapAllocations[layer]);
+
+        for (UINT cascade = 0; cascade < cascadeCount; cascade++)
+        {
+            D3D12_DEPTH_STENCIL_VIEW_DESC depthViewDesc = {};
+            depthViewDesc.Format = DXGI_FORMAT_D32_FLOAT;
+            depthViewDesc.ViewDimension = D3D12_DSV_DIMENSION_TEXTURE2DARRAY;
+            depthViewDesc.Flags = D3D12_DSV_FLAG_NONE;
+            depthViewDesc.Texture2DArray = { .MipSlice = 0, .FirstArraySlice = cascade, .ArraySize = 1 };
+            device->CreateDepthStencilView(shadowMaps[layer].Get(), &depthViewDesc, CD3DX12_CPU_DESCRIPTOR_HANDLE(
+                shadowDsvHeap->GetCPUDescriptorHandleForHeapStart(), layer * cascadeCount + cascade, dsvDescriptorSize));
+        }
+    }
+
+    D3D12_SHADER_RESOURCE_VIEW_DESC srvDesc = {};
+    srvDesc.Format = DXGI_FORMAT_R32_FLOAT;
+    srvDesc.ViewDimension = D3D12_SRV_DIMENSION_TEXTURE2DARRAY;
+    srvDesc.Shader4ComponentMapping = D3D12_DEFAULT_SHADER_4_COMPONENT_MAPPING;
+    srvDesc.Texture2DArray = { .MostDetailedMip = 0, .MipLevels = 1, .FirstArraySlice = 0,
+        .ArraySize = cascadeCount, .PlaneSlice = 0, .ResourceMinLODClamp = 0.0f };
+
+    shadowMapDescriptor = allocateDescriptor();
+    device->CreateShaderResourceView(shadowMaps[static_cast<UINT>(ShadowLayer::Dynamic)].Get(), &srvDesc,
+        getStagingDescriptor(shadowMapDescriptor));
+    commitDescriptor(shadowMapDescriptor);
+
+    createFrameGraph();
+}
+
+void D3D12Backend::createFrameGraph()
+{
+    for (UINT variant = 0; variant < _countof(frameGraphs); variant++)
+    {
+        RenderGraph& graph = frameGraphs[variant];
+        graph.reset();
+        backBufferResource = graph.importResource("BackBuffer", ResourceState::Present, ResourceState::Present);
+        depthBufferResource = graph.importResource("DepthBuffer", ResourceState::DepthWrite, ResourceState::DepthWrite);
+        staticShadowResource = graph.importResource("StaticShadowMaps",
+            ResourceState::CopySource, ResourceState::CopySource);
+        dynamicShadowResource = graph.importResource("ShadowMaps",
+            ResourceState::ShaderResource, ResourceState::ShaderResource);
+
+        staticShadowPass = graph.addPass("StaticShadows");
+        copyShadowPass = graph.addPass("CopyShadows");
+        dynamicShadowPass = graph.addPass("DynamicShadows");
+        scenePass = graph.addPass("Scene");
+
+        if (shadowCascadeCount > 0)
+        {
+            if (variant == StaticShadowsFrame)
+                graph.write(staticShadowPass, staticShadowResource, ResourceState::DepthWrite);
+            if (variant != CachedShadowsFrame)
+            {
+                graph.read(copyShadowPass, staticShadowResource, ResourceState::CopySource);
+                graph.write(copyShadowPass, dynamicShadowResource, ResourceState::CopyDest);
+                graph.write(dynamicShadowPass, dynamicShadowResource, ResourceState::DepthWrite);
+            }
+            graph.read(scenePass, dynamicShadowResource, ResourceState::ShaderResource);
+        }
+        graph.write(scenePass, backBufferResource, ResourceState::RenderTarget);
+        graph.write(scenePass, depthBufferResource, ResourceState::DepthWrite);
+
+        graph.compile();
+    }
+}
+
+// One ResourceBarrier call per batch. The frame graph has no transients, so
+// every resource is one of the imported ones.
+void D3D12Backend::addBarriers(ID3D12GraphicsCommandList* list, const std::vector<RenderGraphBarrier>& barriers)
+{
+    if (barriers.empty())
+        return;
+
+    std::vector<D3D12_RESOURCE_BARRIER> d3dBarriers;
+    d3dBarriers.reserve(barriers.size());
+    for (const RenderGraphBarrier& barrier : barriers)
+    {
+        ID3D12Resource* resource = barrier.resource == backBufferResource ? renderTargets[frameIndex].Get()
+            : barrier.resource == depthBufferResource ? depthBuffer.Get()
+            : barrier.resource == staticShadowResource ? shadowMaps[static_cast<UINT>(ShadowLayer::Static)].Get()
+            : shadowMaps[static_cast<UINT>(ShadowLayer::Dynamic)].Get();
+
+        if (barrier.type == RenderGraphBarrier::Type::Aliasing)
+        {
+            d3dBarriers.push_back(CD3DX12_RESOURCE_BARRIER::Aliasing(nullptr, resource));
+        }
+        else
+        {
+            d3dBarriers.push_back(CD3DX12_RESOURCE_BARRIER::Transition(resource,
+                getResourceState(barrier.before), getResourceState(barrier.after)));
+        }
+    }
+    list->ResourceBarrier(static_cast<UINT>(d3dBarriers.size()), d3dBarriers.data());
+}
+
+void D3D12Backend::createDescriptorHeaps()
+{
+    const ComPtr<ID3D12DescriptorHeap> oldCpuHeap = cpuDescriptorHeap;
+    const UINT oldCount = oldCpuHeap ? oldCpuHeap->GetDesc().NumDescriptors : 0;
+
+    D3D12_DESCRIPTOR_HEAP_DESC heapDesc = {};
+    heapDesc.NumDescriptors = descriptors.getPersistentCapacity();
+    heapDesc.Type = D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV;
+    heapDesc.Flags = D3D12_DESCRIPTOR_HEAP_FLAG_NONE;
+    heapDesc.NodeMask = 0;
+    ThrowIfFailed(device->CreateDescriptorHeap(&heapDesc, IID_PPV_ARGS(&cpuDescriptorHeap)));
+
+    if (descriptorHeap)
+        releaseQueue.release({ descriptorHeap, nullptr, {} });
+
+    heapDesc.NumDescriptors = descriptors.getHeapSize();
+    heapDesc.Flags = D3D12_DESCRIPTOR_HEAP_FLAG_SHADER_VISIBLE;
+    ThrowIfFailed(device->CreateDescriptorHeap(&heapDesc, IID_PPV_ARGS(&descriptorHeap)));
+
+    // Persistent indices do not change, so both copies keep the old layout.
+    if (oldCount > 0)
+    {
+        device->CopyDescriptorsSimple(oldCount, getStagingDescriptor(0),
+            oldCpuHeap->GetCPUDescriptorHandleForHeapStart(), D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
+        device->CopyDescriptorsSimple(oldCount, getCpuDescriptor(0),
+            getStagingDescriptor(0), D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
+    }
+}
+
+UINT D3D12Backend::allocateDescriptor()
+{
+    const UINT index = descriptors.allocate();
+    if (descriptors.getGeneration() != descriptorGeneration)
+    {
+        descriptorGeneration = descriptors.getGeneration();
+        createDescriptorHeaps();
+    }
+    return index;
+}
+
+void D3D12Backend::commitDescriptor(UINT index)
+{
+    device->CopyDescriptorsSimple(1, getCpuDescriptor(index), getStagingDescriptor(index),
+        D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
+}
+
+D3D12_GPU_DESCRIPTOR_HANDLE D3D12Backend::copyTransientDescriptors(UINT count, D3D12_CPU_DESCRIPTOR_HANDLE source)
+{
+    UINT index;
+    while ((index = descriptors.allocateTransient(count)) == DescriptorAllocator::InvalidIndex)
+    {
+        // Only the current frame is left, it asked for more than the ring has.
+        if (!descriptors.hasPendingFrames())
+            ThrowIfFailed(E_OUTOFMEMORY);
+
+        waitForFenceValue(descriptors.getOldestFenceValue());
+    }
+
+    device->CopyDescriptorsSimple(count, getCpuDescriptor(index), source, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
+    return getGpuDescriptor(index);
+}
+
+D3D12_CPU_DESCRIPTOR_HANDLE D3D12Backend::getStagingDescriptor(UINT index) const
+{
+    return CD3DX12_CPU_DESCRIPTOR_HANDLE(
+        cpuDescriptorHeap->GetCPUDescriptorHandleForHeapStart(), index, cbvSrvDescriptorSize);
+}
+
+D3D12_CPU_DESCRIPTOR_HANDLE D3D12Backend::getCpuDescriptor(UINT index) const
+{
+    return CD3DX12_CPU_DESCRIPTOR_HANDLE(
+        descriptorHeap->GetCPUDescriptorHandleForHeapStart(), index, cbvSrvDescriptorSize);
+}
+
+D3D12_GPU_DESCRIPTOR_HANDLE D3D12Backend::getGpuDescriptor(UINT index) const
+{
+    return CD3DX12_GPU_DESCRIPTOR_HANDLE(
+        descriptorHeap->GetGPUDescriptorHandleForHeapStart(), index, cbvSrvDescriptorSize);
+}
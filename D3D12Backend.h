@@ -0,0 +1,400 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include <d3d12.h>
+#include <dxgi1_6.h>
+#include <wrl.h>
+
+#include "DeferredReleaseQueue.h"
+#include "DescriptorAllocator.h"
+#include "FrameSync.h"
+#include "GpuMemoryPool.h"
+#include "GpuProfiler.h"
+#include "PipelineCache.h"
+#include "RenderBackend.h"
+#include "RenderGraph.h"
+#include "UploadManager.h"
+#include "UploadRing.h"
+
+using Microsoft::WRL::ComPtr;
+
+inline void ThrowIfFailed(HRESULT hr)
+{
+    if (FAILED(hr))
+    {
+        exit(hr);
+    }
+}
+
+class D3D12Backend;
+
+class D3D12CommandRecorder : public CommandRecorder
+{
+public:
+    // Bundles are recorded once, so they wait for their pipelines instead of
+    // keeping a fallback.
+    explicit D3D12CommandRecorder(D3D12Backend& backend, bool bundle = false);
+
+    void setCommandList(ID3D12GraphicsCommandList* list) { commandList = list; }
+
+    void setPipeline(PipelineHandle pipeline) override;
+    void setConstantBuffer(BufferHandle buffer, size_t offset) override;
+    void setMaterialTable(BufferHandle buffer, size_t offset) override;
+    void setMaterial(uint32_t material) override;
+    void setObjectTable(BufferHandle buffer, size_t offset) override;
+    void setObject(uint32_t object) override;
+    void setVertexBuffer(BufferHandle buffer) override;
+    void setInstanceBuffer(BufferHandle buffer, size_t offset, uint32_t instanceCount) override;
+    void draw(uint32_t vertexCount, uint32_t instanceCount,
+        uint32_t firstVertex, uint32_t firstInstance) override;
+    void drawIndirect(BufferHandle buffer, size_t offset, uint32_t drawCount) override;
+    void executeBundle(BundleHandle bundle) override;
+
+private:
+    D3D12Backend& backend;
+    bool bundle;
+    ID3D12GraphicsCommandList* commandList = nullptr;
+};
+
+class D3D12Backend : public RenderBackend
+{
+public:
+    explicit D3D12Backend(UINT framesInFlight = 2);
+
+    void init(uint32_t width, uint32_t height) override;
+    void resize(uint32_t width, uint32_t height) override;
+    void destroy() override;
+
+    BufferHandle createBuffer(const BufferDesc& desc) override;
+    void destroyBuffer(BufferHandle buffer) override;
+    void* mapBuffer(BufferHandle buffer) override;
+    TextureHandle createTexture(const TextureDesc& desc) override;
+    uint32_t getTextureIndex(TextureHandle texture) override { return textures[texture.id - 1].descriptor; }
+    PipelineHandle createPipeline(const PipelineDesc& desc) override;
+
+    bool isBufferReady(BufferHandle buffer) override;
+    bool isTextureReady(TextureHandle texture) override;
+    void flushUploads() override;
+
+    CommandRecorder& beginBundle() override;
+    BundleHandle endBundle() override;
+
+    uint32_t getFramesInFlight() const override { return frameSync.getFramesInFlight(); }
+    uint32_t getFrameSlot() const override { return frameSync.getFrameSlot(); }
+
+    UploadAllocation allocateUpload(size_t size, size_t alignment) override;
+
+    void createShadowMaps(uint32_t size, uint32_t cascadeCount) override;
+    CommandRecorder& beginShadowPass(ShadowLayer layer, uint32_t cascade) override;
+    CommandRecorder& beginFrame(const float clearColor[4]) override;
+
+    uint32_t getMaxParallelRecorders() const override { return MaxParallelRecorders; }
+    CommandRecorder& beginParallelRecorder(uint32_t index) override;
+
+    void submitFrame() override;
+    void present() override;
+
+    bool isTearingSupported() const override { return tearingSupported; }
+    void setPresentParams(const PresentParams& params) override { presentParams = params; }
+    void waitForPresentSlot() override;
+
+    const GpuProfiler* getGpuProfiler() const override { return &gpuProfiler; }
+
+    // Compacts the buffer heaps and frees the heaps that end up empty. Waits
+    // for the GPU; pointers from mapBuffer() have to be fetched again, and
+    // bundles that bind a moved buffer keep its old address, so they have
+    // to be recorded again too.
+    uint32_t defragmentMemory(uint32_t maxMoves);
+    GpuMemoryPool::Stats getMemoryStats() const;
+
+    // Copies count descriptors from a CPU-only heap into this frame's part of
+    // the descriptor ring, e.g. to gather a table. Valid until the frame is
+    // done on the GPU.
+    D3D12_GPU_DESCRIPTOR_HANDLE copyTransientDescriptors(UINT count, D3D12_CPU_DESCRIPTOR_HANDLE source);
+
+private:
+    friend class D3D12CommandRecorder;
+
+    static constexpr UINT64 HeapPageSize = 64 * 1024 * 1024;
+
+    // Pipelines compile on their own threads, next to the ones recording.
+    static constexpr uint32_t PipelineCompileThreads = 2;
+    // Next to the executable's working directory; rewritten on exit when
+    // new pipelines were compiled.
+    static constexpr const char* PipelineLibraryPath = "pipelines.bin";
+
+    // Resources are placed into shared heaps; with resource heap tier 1
+    // buffers, textures and render targets each need heaps of their own.
+    struct HeapPool
+    {
+        D3D12_HEAP_TYPE type;
+        D3D12_HEAP_FLAGS flags;
+        GpuMemoryPool allocator;
+        std::vector<ComPtr<ID3D12Heap>> heaps;
+
+        HeapPool(D3D12_HEAP_TYPE type, D3D12_HEAP_FLAGS flags) :
+            type(type), flags(flags), allocator(HeapPageSize) {}
+    };
+
+    struct Buffer
+    {
+        ComPtr<ID3D12Resource> resource;
+        D3D12_VERTEX_BUFFER_VIEW view;
+        UINT8* data;
+        MemoryType memory;
+        GpuMemoryPool::Allocation allocation;
+        UINT64 uploadFenceValue;
+    };
+
+    struct Texture
+    {
+        ComPtr<ID3D12Resource> resource;
+        UINT descriptor;
+        GpuMemoryPool::Allocation allocation;
+        UINT64 uploadFenceValue;
+    };
+
+    static constexpr UINT MinBackBufferCount = 2;
+    static constexpr UINT MaxParallelRecorders = 8;
+    // Root parameters, see createRootSignature().
+    static const UINT FrameConstantsParameter = 0;
+    static const UINT DrawConstantsParameter = 1;
+    static const UINT MaterialTableParameter = 2;
+    static const UINT TexturesParameter = 3;
+    static const UINT ObjectTableParameter = 4;
+    static const UINT ShadowMapParameter = 5;
+
+    static const UINT InitialDescriptorCount = 256;
+    static const UINT TransientDescriptorCount = 1024;
+
+    UINT width;
+    UINT height;
+    UINT backBufferCount;
+
+    // The swap chain always has a frame latency waitable object, and allows
+    // tearing where the display supports it; ResizeBuffers needs the flags.
+    UINT swapChainFlags = 0;
+    bool tearingSupported = false;
+    HANDLE frameLatencyWaitableObject = nullptr;
+    PresentParams presentParams;
+
+    // resize() only records the size; beginFrame() applies it, so a window
+    // drag resizes at most once per frame.
+    UINT pendingWidth;
+    UINT pendingHeight;
+    bool resizePending = false;
+
+    // Pipeline objects.
+    D3D12_VIEWPORT viewport;
+    ComPtr<ID3D12Device> device;
+    ComPtr<IDXGISwapChain3> swapChain;
+    ComPtr<ID3D12CommandQueue> commandQueue;
+    ComPtr<ID3D12GraphicsCommandList> commandList;
+    ComPtr<ID3D12CommandAllocator> commandAllocators[FrameSync::MaxFramesInFlight];
+    ComPtr<ID3D12RootSignature> rootSignature;
+    // Reads IndirectDrawCommand: draw constants, then the draw arguments.
+    ComPtr<ID3D12CommandSignature> drawCommandSignature;
+    ComPtr<ID3D12DescriptorHeap> rtvHeap;
+    ComPtr<ID3D12DescriptorHeap> descriptorHeap;
+    ComPtr<ID3D12DescriptorHeap> depthBufferHeap;
+    ComPtr<ID3D12Resource> renderTargets[FrameSync::MaxFramesInFlight];
+    D3D12_RECT scissorRect;
+
+    UINT rtvDescriptorSize;
+    UINT cbvSrvDescriptorSize;
+
+    // Views are created in cpuDescriptorHeap, which is never shader visible,
+    // and copied into descriptorHeap. Growing rebuilds descriptorHeap from
+    // that copy; the old heap is kept until the frames using it are done.
+    ComPtr<ID3D12DescriptorHeap> cpuDescriptorHeap;
+    DescriptorAllocator descriptors;
+    uint32_t descriptorGeneration = 0;
+
+    // App resources.
+    HeapPool uploadBufferHeaps{ D3D12_HEAP_TYPE_UPLOAD, D3D12_HEAP_FLAG_ALLOW_ONLY_BUFFERS };
+    HeapPool defaultBufferHeaps{ D3D12_HEAP_TYPE_DEFAULT, D3D12_HEAP_FLAG_ALLOW_ONLY_BUFFERS };
+    HeapPool readbackBufferHeaps{ D3D12_HEAP_TYPE_READBACK, D3D12_HEAP_FLAG_ALLOW_ONLY_BUFFERS };
+    HeapPool textureHeaps{ D3D12_HEAP_TYPE_DEFAULT, D3D12_HEAP_FLAG_ALLOW_ONLY_NON_RT_DS_TEXTURES };
+    HeapPool targetHeaps{ D3D12_HEAP_TYPE_DEFAULT, D3D12_HEAP_FLAG_ALLOW_ONLY_RT_DS_TEXTURES };
+
+    // Resources and heaps dropped while frames in flight may still use them.
+    // A placed resource takes its pool allocation along, so the memory is not
+    // handed out again before the GPU is done with it either.
+    struct ReleasedObject
+    {
+        ComPtr<ID3D12Pageable> object;
+        HeapPool* pool;
+        GpuMemoryPool::Allocation allocation;
+    };
+
+    DeferredReleaseQueue<ReleasedObject> releaseQueue;
+
+    std::vector<Buffer> buffers;
+    std::vector<Texture> textures;
+    // Compiled pipelines are stored in pipelineLibrary under their hash, so
+    // the next run loads them instead of compiling. The library reads from
+    // pipelineLibraryData for as long as it lives, and the cache's compile
+    // threads use it until the cache is gone.
+    std::vector<char> pipelineLibraryData;
+    ComPtr<ID3D12PipelineLibrary> pipelineLibrary;
+    std::atomic<bool> pipelineLibraryChanged = false;
+    std::unique_ptr<PipelineCache<ComPtr<ID3D12PipelineState>>> pipelines;
+
+    // Every frame is timed from openFrame() to submitFrame(), with a scope
+    // per render graph pass; a slot's timestamps are resolved into its part
+    // of timestampBuffer and read when the slot is opened again.
+    GpuProfiler gpuProfiler;
+    ComPtr<ID3D12QueryHeap> timestampQueryHeap;
+    BufferHandle timestampBuffer;
+    UINT64 timestampFrequency = 1;
+    bool passScopeOpen = false;
+
+    ComPtr<ID3D12Resource> depthBuffer;
+    GpuMemoryPool::Allocation depthBufferAllocation;
+
+    // Depth arrays with a slice per cascade, indexed by ShadowLayer. The
+    // first cascade count DSVs in shadowDsvHeap are the static slices, the
+    // rest the dynamic ones; the scene samples the dynamic array.
+    UINT shadowCascadeCount = 0;
+    D3D12_VIEWPORT shadowViewport;
+    ComPtr<ID3D12DescriptorHeap> shadowDsvHeap;
+    UINT dsvDescriptorSize;
+    ComPtr<ID3D12Resource> shadowMaps[2];
+    GpuMemoryPool::Allocation shadowMapAllocations[2];
+    UINT shadowMapDescriptor;
+    bool shadowMapsCleared = false;
+
+    // The frame as a render graph, the begin functions and submitFrame()
+    // issue its barriers. It does not depend on the window size, so it is
+    // compiled once per variant: the shadow layers are sampled as they are,
+    // the dynamic ones are rebuilt from a copy of the static ones, or the
+    // static ones are redrawn first. All variants have the same passes; the
+    // ones a variant skips access nothing and are culled.
+    static const UINT CachedShadowsFrame = 0;
+    static const UINT DynamicShadowsFrame = 1;
+    static const UINT StaticShadowsFrame = 2;
+    RenderGraph frameGraphs[3];
+    uint32_t backBufferResource;
+    uint32_t depthBufferResource;
+    uint32_t staticShadowResource;
+    uint32_t dynamicShadowResource;
+    uint32_t staticShadowPass;
+    uint32_t copyShadowPass;
+    uint32_t dynamicShadowPass;
+    uint32_t scenePass;
+
+    // The first begin function of a frame opens commandList; passes before
+    // nextPass already had their barriers issued.
+    bool frameOpen = false;
+    UINT frameVariant = CachedShadowsFrame;
+    uint32_t nextPass = 0;
+    // Whether the dynamic layers hold nothing but a copy of the static ones,
+    // so a frame without shadow passes can skip the copy.
+    bool frameDynamicShadows = false;
+    bool shadowLayersMatch = false;
+
+    BufferHandle uploadBuffer;
+    UploadRing uploadRing;
+
+    // Static data goes to DEFAULT heap resources through the copy queue.
+    // Every batch gets an allocator of its own, reused once its fence value
+    // has completed.
+    struct CopyAllocator
+    {
+        ComPtr<ID3D12CommandAllocator> allocator;
+        UINT64 fenceValue;
+    };
+
+    ComPtr<ID3D12CommandQueue> copyQueue;
+    ComPtr<ID3D12GraphicsCommandList> copyList;
+    std::vector<CopyAllocator> copyAllocators;
+    size_t openCopyAllocator = 0;
+    bool copyListOpen = false;
+    ComPtr<ID3D12Fence> copyFence;
+    HANDLE copyFenceEvent;
+    BufferHandle stagingBuffer;
+    UploadManager uploads;
+
+    // Synchronization objects.
+    UINT frameIndex;
+    HANDLE fenceEvent;
+    ComPtr<ID3D12Fence> fence;
+    FrameSync frameSync;
+
+    D3D12CommandRecorder recorder;
+
+    // Lists filled by worker threads, one allocator per list and frame slot.
+    // When they are used the present barrier goes into closingList, which
+    // runs after all of them.
+    ComPtr<ID3D12CommandAllocator> parallelAllocators[FrameSync::MaxFramesInFlight][MaxParallelRecorders];
+    ComPtr<ID3D12GraphicsCommandList> parallelLists[MaxParallelRecorders];
+    std::vector<D3D12CommandRecorder> parallelRecorders;
+    bool parallelUsed[MaxParallelRecorders] = {};
+    ComPtr<ID3D12CommandAllocator> closingAllocators[FrameSync::MaxFramesInFlight];
+    ComPtr<ID3D12GraphicsCommandList> closingList;
+
+    // Bundles live as long as the backend, so their allocator is never reset.
+    ComPtr<ID3D12CommandAllocator> bundleAllocator;
+    ComPtr<ID3D12GraphicsCommandList> openBundle;
+    std::vector<ComPtr<ID3D12GraphicsCommandList>> bundles;
+    D3D12CommandRecorder bundleRecorder;
+
+    void loadPipeline();
+    void waitForGpu();
+    void moveToNextFrame();
+    void waitForFenceValue(UINT64 value);
+
+    void createCommandQueue();
+    void createSwapChain(ComPtr<IDXGIFactory7> factory);
+    void createHeaps();
+    void createRenderTargets();
+    void createCommandAllocators();
+
+    void createRootSignature();
+    void createCommandSignature();
+    void createPipelineCache();
+    void createTimestampQueries();
+    void writeTimestamp(ID3D12GraphicsCommandList* list, uint32_t query);
+    // Runs on the compile threads.
+    ComPtr<ID3D12PipelineState> compilePipeline(const PipelineDesc& desc, uint64_t hash);
+    void savePipelineLibrary();
+    void createCommandList();
+    void setFrameState(ID3D12GraphicsCommandList* list);
+    void openFrame(UINT variant);
+    // Issues the barriers of every pass up to and including pass, and the
+    // shadow copy if it is among them.
+    void advanceFrame(uint32_t pass);
+    const RenderGraph& getFrameGraph() const { return frameGraphs[frameVariant]; }
+    void createDepthBuffer();
+    void applyResize();
+    void createFrameGraph();
+    void addBarriers(ID3D12GraphicsCommandList* list, const std::vector<RenderGraphBarrier>& barriers);
+    void createFence();
+    void createUploadRing();
+    void createCopyQueue();
+
+    // Returns an offset in stagingBuffer and leaves copyList open for the copy.
+    size_t allocateStaging(size_t size, size_t alignment);
+    void openCopyList();
+    void waitForCopyFenceValue(UINT64 value);
+
+    HeapPool& getBufferHeaps(MemoryType memory);
+    ComPtr<ID3D12Resource> createPlacedResource(HeapPool& pool, const D3D12_RESOURCE_DESC& desc,
+        D3D12_RESOURCE_STATES state, const D3D12_CLEAR_VALUE* clearValue, uint64_t owner,
+        GpuMemoryPool::Allocation& allocation);
+    void releaseEmptyHeaps(HeapPool& pool);
+    static void freeReleasedObject(ReleasedObject& released);
+
+    void createDescriptorHeaps();
+    // Persistent descriptors have to be allocated outside frame recording: a
+    // grown heap is only bound by the next frame.
+    UINT allocateDescriptor();
+    // Publishes a view written at getStagingDescriptor(index).
+    void commitDescriptor(UINT index);
+    D3D12_CPU_DESCRIPTOR_HANDLE getStagingDescriptor(UINT index) const;
+    D3D12_CPU_DESCRIPTOR_HANDLE getCpuDescriptor(UINT index) const;
+    D3D12_GPU_DESCRIPTOR_HANDLE getGpuDescriptor(UINT index) const;
+};
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <utility>
+#include <vector>
+
+// Keeps objects the GPU may still be using until every frame that could have
+// used them has completed. Objects released while a frame is recorded, or
+// between two frames, belong to that frame: finishFrame() stamps them with
+// its fence value, the way UploadRing tracks its allocations, and retire()
+// hands them back once the value completes. Not thread safe.
+template <typename T>
+class DeferredReleaseQueue
+{
+public:
+    void release(T object) { pending.push_back(std::move(object)); }
+
+    void finishFrame(uint64_t fenceValue)
+    {
+        for (T& object : pending)
+            entries.push_back({ fenceValue, std::move(object) });
+        pending.clear();
+    }
+
+    // function(T&) runs for every object whose frame has completed, right
+    // before it is destroyed.
+    template <typename Function>
+    void retire(uint64_t completedFenceValue, Function function)
+    {
+        while (!entries.empty() && entries.front().fenceValue <= completedFenceValue)
+        {
+            function(entries.front().object);
+            entries.pop_front();
+        }
+    }
+
+    // Releases everything, unfinished frames included; the GPU has to be idle.
+    template <typename Function>
+    void flush(Function function)
+    {
+        for (Entry& entry : entries)
+            function(entry.object);
+        for (T& object : pending)
+            function(object);
+        entries.clear();
+        pending.clear();
+    }
+
+    size_t getSize() const { return pending.size() + entries.size(); }
+
+private:
+    struct Entry
+    {
+        uint64_t fenceValue;
+        T object;
+    };
+
+    std::vector<T> pending;
+    std::deque<Entry> entries;
+};
@@ -0,0 +1,83 @@
+#include "DescriptorAllocator.h"
+
+#include <algorithm>
+
+void DescriptorAllocator::init(uint32_t persistentCapacity, uint32_t transientCapacity)
+{
+    this->persistentCapacity = persistentCapacity;
+    allocatedCount = 0;
+    generation = 0;
+    freeRanges.assign(1, { 0, persistentCapacity });
+    transient.init(transientCapacity);
+}
+
+uint32_t DescriptorAllocator::allocate(uint32_t count)
+{
+    auto range = std::find_if(freeRanges.begin(), freeRanges.end(),
+        [count](const Range& range) { return range.count >= count; });
+    if (range == freeRanges.end())
+    {
+        grow(count);
+        range = freeRanges.end() - 1;
+    }
+
+    const uint32_t index = range->start;
+    range->start += count;
+    range->count -= count;
+    if (range->count == 0)
+        freeRanges.erase(range);
+
+    allocatedCount += count;
+    return index;
+}
+
+void DescriptorAllocator::free(uint32_t index, uint32_t count)
+{
+    allocatedCount -= count;
+
+    auto next = std::lower_bound(freeRanges.begin(), freeRanges.end(), index,
+        [](const Range& range, uint32_t index) { return range.start < index; });
+
+    if (next != freeRanges.begin() && (next - 1)->start + (next - 1)->count == index)
+    {
+        auto previous = next - 1;
+        previous->count += count;
+        if (next != freeRanges.end() && previous->start + previous->count == next->start)
+        {
+            previous->count += next->count;
+            freeRanges.erase(next);
+        }
+        return;
+    }
+
+    if (next != freeRanges.end() && index + count == next->start)
+    {
+        next->start = index;
+        next->count += count;
+        return;
+    }
+
+    freeRanges.insert(next, { index, count });
+}
+
+void DescriptorAllocator::grow(uint32_t count)
+{
+    const uint32_t oldCapacity = persistentCapacity;
+    persistentCapacity = std::max(oldCapacity * 2, oldCapacity + count);
+    generation++;
+
+    // The new space continues a free range that reaches the old end.
+    if (!freeRanges.empty() && freeRanges.back().start + freeRanges.back().count == oldCapacity)
+        freeRanges.back().count += persistentCapacity - oldCapacity;
+    else
+        freeRanges.push_back({ oldCapacity, persistentCapacity - oldCapacity });
+}
+
+uint32_t DescriptorAllocator::allocateTransient(uint32_t count)
+{
+    size_t offset;
+    if (!transient.allocate(count, 1, offset))
+        return InvalidIndex;
+
+    return persistentCapacity + static_cast<uint32_t>(offset);
+}
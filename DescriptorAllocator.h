@@ -0,0 +1,55 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "UploadRing.h"
+
+// Index bookkeeping for one shader visible CBV/SRV/UAV heap. The front of the
+// heap holds persistent descriptors from a free list; they keep their index
+// for their whole life. The back is a ring of transient descriptors that are
+// recycled per frame the same way as UploadRing memory. When the persistent
+// part runs out it doubles: persistent indices stay valid, the transient ring
+// moves behind the new end, and getGeneration() changes so the backend knows
+// to recreate the heap. No API types, so it runs without a device.
+class DescriptorAllocator
+{
+public:
+    static constexpr uint32_t InvalidIndex = UINT32_MAX;
+
+    void init(uint32_t persistentCapacity, uint32_t transientCapacity);
+
+    // First of count contiguous persistent descriptors.
+    uint32_t allocate(uint32_t count = 1);
+    void free(uint32_t index, uint32_t count = 1);
+
+    // InvalidIndex when the ring is full of frames still in flight; wait for
+    // getOldestFenceValue(), retire() and try again.
+    uint32_t allocateTransient(uint32_t count);
+    void finishFrame(uint64_t fenceValue) { transient.finishFrame(fenceValue); }
+    void retire(uint64_t completedFenceValue) { transient.retire(completedFenceValue); }
+    bool hasPendingFrames() const { return transient.hasPendingFrames(); }
+    uint64_t getOldestFenceValue() const { return transient.getOldestFenceValue(); }
+
+    uint32_t getPersistentCapacity() const { return persistentCapacity; }
+    uint32_t getTransientCapacity() const { return static_cast<uint32_t>(transient.getCapacity()); }
+    uint32_t getHeapSize() const { return persistentCapacity + getTransientCapacity(); }
+    uint32_t getAllocatedCount() const { return allocatedCount; }
+    uint32_t getGeneration() const { return generation; }
+
+private:
+    struct Range
+    {
+        uint32_t start;
+        uint32_t count;
+    };
+
+    uint32_t persistentCapacity = 0;
+    uint32_t allocatedCount = 0;
+    uint32_t generation = 0;
+    // Sorted by start, neighbours are always merged.
+    std::vector<Range> freeRanges;
+    UploadRing transient;
+
+    void grow(uint32_t count);
+};
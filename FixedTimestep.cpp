@@ -0,0 +1,25 @@
+#include "FixedTimestep.h"
+
+FixedTimestep::FixedTimestep(double stepsPerSecond, uint32_t maxStepsPerFrame) :
+    stepTime(static_cast<uint64_t>(1e9 / stepsPerSecond)),
+    maxStepsPerFrame(maxStepsPerFrame)
+{
+}
+
+uint32_t FixedTimestep::advance(uint64_t now)
+{
+    if (lastTime != 0 && now > lastTime)
+        accumulator += now - lastTime;
+    lastTime = now;
+
+    steps = 0;
+    while (accumulator >= stepTime && steps < maxStepsPerFrame)
+    {
+        accumulator -= stepTime;
+        steps++;
+    }
+
+    if (accumulator >= stepTime)
+        accumulator %= stepTime;
+    return steps;
+}
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <cstdint>
+
+// Runs the simulation in steps of a fixed length, however often frames come.
+// Every frame advance() adds the time since the previous frame to an
+// accumulator and returns how many whole steps fit into it; what is left
+// over, as a fraction of a step, is how far rendering should interpolate
+// from the state before the last step towards the state after it. Times are
+// in nanoseconds, as from FrameClock.
+class FixedTimestep
+{
+public:
+    explicit FixedTimestep(double stepsPerSecond = 60.0, uint32_t maxStepsPerFrame = 8);
+
+    // Steps to run this frame. After a stall that would take more than
+    // maxStepsPerFrame steps, the rest of the time is dropped, so the
+    // simulation slows down instead of falling further and further behind.
+    uint32_t advance(uint64_t now);
+
+    float getStepSeconds() const { return static_cast<float>(stepTime) * 1e-9f; }
+    // Time the given step of the last advance() stands for the end of, e.g.
+    // to take the input up to it.
+    uint64_t getStepEndTime(uint32_t step) const { return lastTime - accumulator - (steps - 1 - step) * stepTime; }
+    // 0 shows the previous state, 1 the latest one.
+    float getInterpolation() const { return static_cast<float>(accumulator) / static_cast<float>(stepTime); }
+
+private:
+    uint64_t stepTime;
+    uint32_t maxStepsPerFrame;
+
+    // 0 until the first frame.
+    uint64_t lastTime = 0;
+    uint64_t accumulator = 0;
+    uint32_t steps = 0;
+};
@@ -0,0 +1,67 @@
+#include "FramePacer.h"
+
+#include <chrono>
+#include <thread>
+
+uint64_t SystemClock::now()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void SystemClock::sleepUntil(uint64_t time)
+{
+    const uint64_t current = now();
+    if (time > current + SpinTime)
+        std::this_thread::sleep_for(std::chrono::nanoseconds(time - current - SpinTime));
+
+    while (now() < time)
+        std::this_thread::yield();
+}
+
+FramePacer::FramePacer(FrameClock& clock) :
+    clock(clock)
+{
+}
+
+void FramePacer::setMode(PacingMode mode)
+{
+    this->mode = mode;
+    nextFrameTime = 0;
+}
+
+void FramePacer::setFrameCap(double framesPerSecond)
+{
+    framePeriod = framesPerSecond > 0.0 ? static_cast<uint64_t>(1e9 / framesPerSecond) : 0;
+    nextFrameTime = 0;
+}
+
+PresentParams FramePacer::getPresentParams(bool tearingSupported) const
+{
+    PresentParams params;
+    params.syncInterval = mode == PacingMode::LowLatency ? 1 : 0;
+    params.allowTearing = mode != PacingMode::LowLatency && tearingSupported;
+    return params;
+}
+
+void FramePacer::beginFrame()
+{
+    if (mode == PacingMode::FixedCap && framePeriod > 0)
+    {
+        const uint64_t current = clock.now();
+
+        // A frame that is a little late keeps the schedule and the next ones
+        // catch up; after a longer stall (a hitch, a breakpoint) the schedule
+        // restarts instead of running a burst of frames back to back.
+        if (nextFrameTime == 0 || current > nextFrameTime + framePeriod)
+            nextFrameTime = current;
+        else if (current < nextFrameTime)
+            clock.sleepUntil(nextFrameTime);
+
+        nextFrameTime += framePeriod;
+    }
+
+    const uint64_t start = clock.now();
+    frameTime = frameStart ? start - frameStart : 0;
+    frameStart = start;
+}
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <cstdint>
+
+#include "RenderBackend.h"
+
+enum class PacingMode
+{
+    // Vsync with at most one frame queued for the display. The frame waits
+    // for the swap chain before input is sampled, so input is at most a
+    // frame old when it is shown.
+    LowLatency,
+    // Presents as soon as a frame is done, tearing when the display allows.
+    Uncapped,
+    // Like Uncapped, but frames start no more often than the cap.
+    FixedCap
+};
+
+// Time source in nanoseconds. FramePacer only reads time through it, so a
+// simulated clock can stand in for the real one.
+class FrameClock
+{
+public:
+    virtual ~FrameClock() = default;
+
+    virtual uint64_t now() = 0;
+    virtual void sleepUntil(uint64_t time) = 0;
+};
+
+class SystemClock : public FrameClock
+{
+public:
+    uint64_t now() override;
+    void sleepUntil(uint64_t time) override;
+
+private:
+    // Sleeping overshoots by up to a scheduler tick, so the last part of the
+    // wait is spun.
+    static constexpr uint64_t SpinTime = 2000000;
+};
+
+// Decides when a frame starts and how it is presented. beginFrame() goes
+// first thing in the frame, before input is sampled: in LowLatency mode
+// after the caller has waited on the backend (shouldWaitForPresentSlot()),
+// in FixedCap mode it sleeps until the frame's start time itself.
+class FramePacer
+{
+public:
+    explicit FramePacer(FrameClock& clock);
+
+    void setMode(PacingMode mode);
+    PacingMode getMode() const { return mode; }
+    void setFrameCap(double framesPerSecond);
+
+    bool shouldWaitForPresentSlot() const { return mode == PacingMode::LowLatency; }
+    PresentParams getPresentParams(bool tearingSupported) const;
+
+    void beginFrame();
+
+    // Time between the starts of the last two frames.
+    uint64_t getFrameTime() const { return frameTime; }
+
+private:
+    FrameClock& clock;
+    PacingMode mode = PacingMode::LowLatency;
+    uint64_t framePeriod = 0;
+
+    // Start of the next capped frame, 0 when the schedule has to restart.
+    uint64_t nextFrameTime = 0;
+    uint64_t frameStart = 0;
+    uint64_t frameTime = 0;
+};
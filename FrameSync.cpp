@@ -0,0 +1,18 @@
+#include "FrameSync.h"
+
+#include <algorithm>
+
+FrameSync::FrameSync(uint32_t framesInFlight) :
+    framesInFlight(std::min(std::max(framesInFlight, 1u), MaxFramesInFlight))
+{
+}
+
+uint64_t FrameSync::endFrame()
+{
+    const uint64_t value = nextFenceValue();
+    slotFenceValues[slot] = value;
+
+    slot = (slot + 1) % framesInFlight;
+    frameNumber++;
+    return value;
+}
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <cstdint>
+
+// Fence bookkeeping for N frames in flight. Frame F is recorded into slot
+// F % N, so before reusing a slot the CPU only has to wait for the fence value
+// signalled by frame F - N, the previous user of that slot.
+class FrameSync
+{
+public:
+    static constexpr uint32_t MaxFramesInFlight = 4;
+
+    explicit FrameSync(uint32_t framesInFlight = 2);
+
+    uint32_t getFramesInFlight() const { return framesInFlight; }
+    uint32_t getFrameSlot() const { return slot; }
+    uint64_t getFrameNumber() const { return frameNumber; }
+
+    // Value that has to be completed before the current slot is reused.
+    uint64_t getSlotFenceValue() const { return slotFenceValues[slot]; }
+    uint64_t getLastFenceValue() const { return fenceValue; }
+
+    // Fresh value for a signal outside the frame loop (uploads, idle waits).
+    uint64_t nextFenceValue() { return ++fenceValue; }
+
+    // Call once the frame's work is submitted: assigns the value to signal for
+    // the current slot and moves to the next one.
+    uint64_t endFrame();
+
+private:
+    uint32_t framesInFlight;
+    uint32_t slot = 0;
+    uint64_t frameNumber = 0;
+    uint64_t fenceValue = 0;
+    uint64_t slotFenceValues[MaxFramesInFlight] = {};
+};
@@ -0,0 +1,158 @@
+#include "FrustumCulling.h"
+
+#include <algorithm>
+#include <cmath>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+Frustum extractFrustum(FXMMATRIX viewProj)
+{
+    // Clip space x, y and z of a point are its dot products with the
+    // matrix's columns; inside is -w <= x <= w, -w <= y <= w, 0 <= z <= w.
+    XMFLOAT4X4 m;
+    XMStoreFloat4x4(&m, viewProj);
+    const XMVECTOR x = XMVectorSet(m._11, m._21, m._31, m._41);
+    const XMVECTOR y = XMVectorSet(m._12, m._22, m._32, m._42);
+    const XMVECTOR z = XMVectorSet(m._13, m._23, m._33, m._43);
+    const XMVECTOR w = XMVectorSet(m._14, m._24, m._34, m._44);
+
+    const XMVECTOR planes[6] = { w + x, w - x, w + y, w - y, z, w - z };
+
+    Frustum frustum;
+    for (int i = 0; i < 6; i++)
+        XMStoreFloat4(&frustum.planes[i], XMPlaneNormalize(planes[i]));
+    return frustum;
+}
+
+void CullingBounds::clear()
+{
+    count = 0;
+    for (std::vector<float>* component : { &centerX, &centerY, &centerZ, &extentX, &extentY, &extentZ, &radius })
+        component->clear();
+}
+
+void CullingBounds::reserve(size_t count)
+{
+    const size_t padded = (count + Width - 1) / Width * Width;
+    for (std::vector<float>* component : { &centerX, &centerY, &centerZ, &extentX, &extentY, &extentZ, &radius })
+        component->reserve(padded);
+}
+
+void CullingBounds::add(const XMFLOAT3& center, const XMFLOAT3& extents, float radius, FXMMATRIX world)
+{
+    // Padding lanes are zero; the kernel masks them off.
+    if (count % Width == 0)
+    {
+        for (std::vector<float>* component : { &centerX, &centerY, &centerZ, &extentX, &extentY, &extentZ, &this->radius })
+            component->resize(count + Width, 0.0f);
+    }
+
+    set(count++, center, extents, radius, world);
+}
+
+void CullingBounds::set(size_t index, const XMFLOAT3& center, const XMFLOAT3& extents, float radius, FXMMATRIX world)
+{
+    XMFLOAT4X4 m;
+    XMStoreFloat4x4(&m, world);
+
+    XMFLOAT3 worldCenter;
+    XMStoreFloat3(&worldCenter, XMVector3TransformCoord(XMLoadFloat3(&center), world));
+    centerX[index] = worldCenter.x;
+    centerY[index] = worldCenter.y;
+    centerZ[index] = worldCenter.z;
+
+    // The rows are the object's axes in world space; the AABB around the
+    // moved box spans the absolute sum of them, scaled by the extents.
+    extentX[index] = std::fabs(m._11) * extents.x + std::fabs(m._21) * extents.y + std::fabs(m._31) * extents.z;
+    extentY[index] = std::fabs(m._12) * extents.x + std::fabs(m._22) * extents.y + std::fabs(m._32) * extents.z;
+    extentZ[index] = std::fabs(m._13) * extents.x + std::fabs(m._23) * extents.y + std::fabs(m._33) * extents.z;
+
+    const float scale = std::sqrt(std::max({
+        m._11 * m._11 + m._12 * m._12 + m._13 * m._13,
+        m._21 * m._21 + m._22 * m._22 + m._23 * m._23,
+        m._31 * m._31 + m._32 * m._32 + m._33 * m._33 }));
+    this->radius[index] = radius * scale;
+}
+
+void cullBoundsScalar(const CullingBounds& bounds, const Frustum& frustum, std::vector<uint32_t>& visible)
+{
+    for (size_t i = 0; i < bounds.size(); i++)
+    {
+        bool inside = true;
+        for (const XMFLOAT4& plane : frustum.planes)
+        {
+            const float distance = plane.x * bounds.getCenterX()[i] + plane.y * bounds.getCenterY()[i]
+                + plane.z * bounds.getCenterZ()[i] + plane.w;
+            const float reach = std::min(bounds.getRadius()[i], std::fabs(plane.x) * bounds.getExtentX()[i]
+                + std::fabs(plane.y) * bounds.getExtentY()[i] + std::fabs(plane.z) * bounds.getExtentZ()[i]);
+            inside = inside && distance + reach >= 0.0f;
+        }
+
+        if (inside)
+            visible.push_back(static_cast<uint32_t>(i));
+    }
+}
+
+void cullBounds(const CullingBounds& bounds, const Frustum& frustum, std::vector<uint32_t>& visible)
+{
+#if defined(__AVX2__)
+    __m256 planeX[6], planeY[6], planeZ[6], planeW[6];
+    __m256 absX[6], absY[6], absZ[6];
+    for (int p = 0; p < 6; p++)
+    {
+        const XMFLOAT4& plane = frustum.planes[p];
+        planeX[p] = _mm256_set1_ps(plane.x);
+        planeY[p] = _mm256_set1_ps(plane.y);
+        planeZ[p] = _mm256_set1_ps(plane.z);
+        planeW[p] = _mm256_set1_ps(plane.w);
+        absX[p] = _mm256_set1_ps(std::fabs(plane.x));
+        absY[p] = _mm256_set1_ps(std::fabs(plane.y));
+        absZ[p] = _mm256_set1_ps(std::fabs(plane.z));
+    }
+
+    // Every lane's index is written and the count only moves past the
+    // visible ones, so the list is compacted without branches.
+    const size_t count = bounds.size();
+    const size_t first = visible.size();
+    visible.resize(first + count + CullingBounds::Width);
+    uint32_t* out = visible.data() + first;
+    size_t written = 0;
+
+    for (size_t i = 0; i < count; i += CullingBounds::Width)
+    {
+        const __m256 cx = _mm256_loadu_ps(bounds.getCenterX() + i);
+        const __m256 cy = _mm256_loadu_ps(bounds.getCenterY() + i);
+        const __m256 cz = _mm256_loadu_ps(bounds.getCenterZ() + i);
+        const __m256 ex = _mm256_loadu_ps(bounds.getExtentX() + i);
+        const __m256 ey = _mm256_loadu_ps(bounds.getExtentY() + i);
+        const __m256 ez = _mm256_loadu_ps(bounds.getExtentZ() + i);
+        const __m256 r = _mm256_loadu_ps(bounds.getRadius() + i);
+
+        __m256 inside = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+        for (int p = 0; p < 6; p++)
+        {
+            const __m256 distance = _mm256_fmadd_ps(planeX[p], cx,
+                _mm256_fmadd_ps(planeY[p], cy, _mm256_fmadd_ps(planeZ[p], cz, planeW[p])));
+            const __m256 reach = _mm256_min_ps(r,
+                _mm256_fmadd_ps(absX[p], ex, _mm256_fmadd_ps(absY[p], ey, _mm256_mul_ps(absZ[p], ez))));
+            inside = _mm256_and_ps(inside, _mm256_cmp_ps(_mm256_add_ps(distance, reach), _mm256_setzero_ps(), _CMP_GE_OQ));
+        }
+
+        uint32_t mask = static_cast<uint32_t>(_mm256_movemask_ps(inside));
+        if (count - i < CullingBounds::Width)
+            mask &= (1u << (count - i)) - 1;
+
+        for (uint32_t lane = 0; lane < CullingBounds::Width; lane++)
+        {
+            out[written] = static_cast<uint32_t>(i + lane);
+            written += (mask >> lane) & 1;
+        }
+    }
+
+    visible.resize(first + written);
+#else
+    cullBoundsScalar(bounds, frustum, visible);
+#endif
+}
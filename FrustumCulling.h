@@ -0,0 +1,67 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <DirectXMath.h>
+
+using namespace DirectX;
+
+// Six world space planes, normalized, with ax + by + cz + d >= 0 on the
+// inside: left, right, bottom, top, near, far.
+struct Frustum
+{
+    XMFLOAT4 planes[6];
+};
+
+// For a row-vector view-projection matrix with D3D's [0, 1] depth range.
+Frustum extractFrustum(FXMMATRIX viewProj);
+
+// World space bounds of many objects: an AABB and a bounding sphere around
+// the same center. Every component has an array of its own, padded to a
+// multiple of Width, so the SIMD kernel loads a component of 8 objects at
+// once.
+class CullingBounds
+{
+public:
+    static constexpr size_t Width = 8;
+
+    void clear();
+    void reserve(size_t count);
+
+    // Bounds in the object's own space, moved to world space by world. The
+    // sphere grows with the largest scale of world.
+    void add(const XMFLOAT3& center, const XMFLOAT3& extents, float radius, FXMMATRIX world);
+    void set(size_t index, const XMFLOAT3& center, const XMFLOAT3& extents, float radius, FXMMATRIX world);
+
+    size_t size() const { return count; }
+
+    const float* getCenterX() const { return centerX.data(); }
+    const float* getCenterY() const { return centerY.data(); }
+    const float* getCenterZ() const { return centerZ.data(); }
+    // Half sizes of the AABB.
+    const float* getExtentX() const { return extentX.data(); }
+    const float* getExtentY() const { return extentY.data(); }
+    const float* getExtentZ() const { return extentZ.data(); }
+    const float* getRadius() const { return radius.data(); }
+
+private:
+    size_t count = 0;
+    std::vector<float> centerX;
+    std::vector<float> centerY;
+    std::vector<float> centerZ;
+    std::vector<float> extentX;
+    std::vector<float> extentY;
+    std::vector<float> extentZ;
+    std::vector<float> radius;
+};
+
+// Appends the indices of the bounds that may be inside the frustum to
+// visible, in increasing order. Against each plane an object counts as
+// outside when its AABB or its sphere, whichever reaches less far, is
+// entirely behind it. Tests 8 objects at a time when built with AVX2, the
+// scalar path otherwise.
+void cullBounds(const CullingBounds& bounds, const Frustum& frustum, std::vector<uint32_t>& visible);
+// Scalar reference of cullBounds().
+void cullBoundsScalar(const CullingBounds& bounds, const Frustum& frustum, std::vector<uint32_t>& visible);
@@ -0,0 +1,145 @@
+#include "GpuMemoryPool.h"
+
+#include <algorithm>
+#include <utility>
+
+GpuMemoryPool::GpuMemoryPool(uint64_t pageSize) :
+    pageSize(pageSize)
+{
+}
+
+uint32_t GpuMemoryPool::addPage(uint64_t size)
+{
+    for (uint32_t i = 0; i < pages.size(); i++)
+    {
+        if (!pages[i])
+        {
+            pages[i] = std::make_unique<HeapAllocator>(size);
+            return i;
+        }
+    }
+
+    pages.push_back(std::make_unique<HeapAllocator>(size));
+    return static_cast<uint32_t>(pages.size() - 1);
+}
+
+GpuMemoryPool::Allocation GpuMemoryPool::allocate(uint64_t size, uint64_t alignment, uint64_t owner)
+{
+    for (uint32_t i = 0; i < pages.size(); i++)
+    {
+        if (!pages[i] || pages[i]->getSize() - pages[i]->getUsedSize() < size)
+            continue;
+
+        const HeapAllocator::Allocation allocation = pages[i]->allocate(size, alignment, owner);
+        if (allocation.isValid())
+            return { i, allocation.block, allocation.offset, allocation.size };
+    }
+
+    const uint64_t newPageSize = std::max(pageSize, (size + alignment - 1) & ~(alignment - 1));
+    const uint32_t page = addPage(newPageSize);
+    const HeapAllocator::Allocation allocation = pages[page]->allocate(size, alignment, owner);
+    if (!allocation.isValid())
+        return Allocation();
+
+    return { page, allocation.block, allocation.offset, allocation.size };
+}
+
+void GpuMemoryPool::free(const Allocation& allocation)
+{
+    pages[allocation.page]->free(allocation.block);
+}
+
+std::vector<GpuMemoryPool::Move> GpuMemoryPool::defragment(uint32_t maxMoves)
+{
+    std::vector<Move> moves;
+
+    std::vector<uint32_t> order;
+    for (uint32_t i = 0; i < pages.size(); i++)
+    {
+        if (pages[i] && !pages[i]->isEmpty())
+            order.push_back(i);
+    }
+    std::sort(order.begin(), order.end(), [this](uint32_t a, uint32_t b) {
+        return pages[a]->getUsedSize() < pages[b]->getUsedSize();
+    });
+
+    // Empty the least used pages into the fullest ones that are left. A
+    // page that took moves is never emptied in turn, so nothing is moved
+    // twice and no copy reads a buffer another copy just wrote.
+    std::vector<bool> received(pages.size(), false);
+    for (size_t source = 0; source + 1 < order.size() && moves.size() < maxMoves; source++)
+    {
+        if (received[order[source]])
+            break;
+
+        HeapAllocator& sourcePage = *pages[order[source]];
+
+        std::vector<std::pair<HeapAllocator::Allocation, uint64_t>> allocations;
+        sourcePage.forEachAllocation([&](const HeapAllocator::Allocation& allocation, uint64_t owner) {
+            allocations.emplace_back(allocation, owner);
+        });
+
+        for (const auto& [allocation, owner] : allocations)
+        {
+            if (moves.size() == maxMoves)
+                break;
+
+            for (size_t target = order.size() - 1; target > source; target--)
+            {
+                HeapAllocator& targetPage = *pages[order[target]];
+                const HeapAllocator::Allocation moved = targetPage.allocate(
+                    allocation.size, allocation.alignment, owner);
+                if (!moved.isValid())
+                    continue;
+
+                moves.push_back({ owner,
+                    { order[source], allocation.block, allocation.offset, allocation.size },
+                    { order[target], moved.block, moved.offset, moved.size } });
+                sourcePage.free(allocation.block);
+                received[order[target]] = true;
+                break;
+            }
+        }
+    }
+
+    return moves;
+}
+
+std::vector<uint32_t> GpuMemoryPool::releaseEmptyPages()
+{
+    std::vector<uint32_t> released;
+    for (uint32_t i = 0; i < pages.size(); i++)
+    {
+        if (pages[i] && pages[i]->isEmpty())
+        {
+            pages[i].reset();
+            released.push_back(i);
+        }
+    }
+    return released;
+}
+
+void GpuMemoryPool::Stats::add(const Stats& other)
+{
+    pageCount += other.pageCount;
+    reservedSize += other.reservedSize;
+    usedSize += other.usedSize;
+    allocationCount += other.allocationCount;
+    freeBlockCount += other.freeBlockCount;
+    largestFreeBlock = std::max(largestFreeBlock, other.largestFreeBlock);
+}
+
+GpuMemoryPool::Stats GpuMemoryPool::getStats() const
+{
+    Stats stats = {};
+    for (const std::unique_ptr<HeapAllocator>& page : pages)
+    {
+        if (!page)
+            continue;
+
+        const HeapAllocator::Stats pageStats = page->getStats();
+        stats.add({ 1, pageStats.size, pageStats.usedSize, pageStats.allocationCount,
+            pageStats.freeBlockCount, pageStats.largestFreeBlock });
+    }
+    return stats;
+}
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "HeapAllocator.h"
+
+// Places resources of one heap kind (e.g. default heap buffers) into a list
+// of large heaps ("pages"), each managed by a HeapAllocator. The pool only
+// does the bookkeeping: after allocate() the backend creates the heap for any
+// page it does not have yet, and after defragment() it copies the moved
+// resources and drops the pages that came back empty.
+class GpuMemoryPool
+{
+public:
+    struct Allocation
+    {
+        uint32_t page = UINT32_MAX;
+        uint32_t block = HeapAllocator::InvalidBlock;
+        uint64_t offset = 0;
+        uint64_t size = 0;
+
+        bool isValid() const { return page != UINT32_MAX; }
+    };
+
+    struct Move
+    {
+        uint64_t owner;
+        Allocation from;
+        Allocation to;
+    };
+
+    struct Stats
+    {
+        uint32_t pageCount;
+        uint64_t reservedSize;
+        uint64_t usedSize;
+        uint32_t allocationCount;
+        uint32_t freeBlockCount;
+        uint64_t largestFreeBlock;
+
+        void add(const Stats& other);
+    };
+
+    explicit GpuMemoryPool(uint64_t pageSize);
+
+    // Requests larger than a page get a page of their own.
+    Allocation allocate(uint64_t size, uint64_t alignment, uint64_t owner);
+    void free(const Allocation& allocation);
+
+    uint32_t getPageCount() const { return static_cast<uint32_t>(pages.size()); }
+    bool hasPage(uint32_t page) const { return page < pages.size() && pages[page]; }
+    uint64_t getPageSize(uint32_t page) const { return pages[page]->getSize(); }
+
+    // Moves up to maxMoves allocations out of the emptiest pages into the
+    // others, each at most once. The returned moves are already applied to the bookkeeping, so
+    // the caller has to copy the data before anything else is allocated.
+    std::vector<Move> defragment(uint32_t maxMoves);
+    // Pages without allocations; they are forgotten and their indices may be
+    // reused by later allocations.
+    std::vector<uint32_t> releaseEmptyPages();
+
+    Stats getStats() const;
+
+private:
+    uint64_t pageSize;
+    std::vector<std::unique_ptr<HeapAllocator>> pages;
+
+    uint32_t addPage(uint64_t size);
+};
@@ -0,0 +1,106 @@
+#include "GpuProfiler.h"
+
+#include <algorithm>
+
+GpuProfiler::GpuProfiler(uint32_t framesInFlight) :
+    framesInFlight(framesInFlight)
+{
+}
+
+void GpuProfiler::beginFrame(uint32_t slot)
+{
+    this->slot = slot;
+    frames[slot].clear();
+    openScopes.clear();
+}
+
+uint32_t GpuProfiler::beginScope(const char* name)
+{
+    std::vector<FrameScope>& frame = frames[slot];
+    if (frame.size() == MaxScopesPerFrame)
+    {
+        openScopes.push_back(InvalidQuery);
+        return InvalidQuery;
+    }
+
+    const uint32_t scope = findScope(name, static_cast<uint32_t>(openScopes.size()));
+    openScopes.push_back(static_cast<uint32_t>(frame.size()));
+    frame.push_back({ scope, false });
+    return getFrameFirstQuery() + 2 * (static_cast<uint32_t>(frame.size()) - 1);
+}
+
+uint32_t GpuProfiler::endScope()
+{
+    const uint32_t index = openScopes.back();
+    openScopes.pop_back();
+    if (index == InvalidQuery)
+        return InvalidQuery;
+
+    frames[slot][index].closed = true;
+    return getFrameFirstQuery() + 2 * index + 1;
+}
+
+void GpuProfiler::collect(uint32_t slot, const uint64_t* timestamps, uint64_t frequency)
+{
+    const double msPerTick = 1000.0 / static_cast<double>(frequency);
+    for (size_t i = 0; i < frames[slot].size(); i++)
+    {
+        const FrameScope& frameScope = frames[slot][i];
+        const uint64_t begin = timestamps[2 * i];
+        const uint64_t end = timestamps[2 * i + 1];
+        if (!frameScope.closed || end < begin)
+            continue;
+
+        Scope& scope = scopes[frameScope.scope];
+        scope.lastMs = static_cast<double>(end - begin) * msPerTick;
+        if (scope.history.size() < HistorySize)
+            scope.history.push_back(scope.lastMs);
+        else
+            scope.history[scope.next] = scope.lastMs;
+        scope.next = (scope.next + 1) % HistorySize;
+    }
+    frames[slot].clear();
+}
+
+std::vector<GpuProfiler::ScopeStats> GpuProfiler::getStats() const
+{
+    std::vector<ScopeStats> result;
+    std::vector<double> sorted;
+    for (const Scope& scope : scopes)
+    {
+        ScopeStats stats = { scope.name, scope.depth, static_cast<uint32_t>(scope.history.size()),
+            scope.lastMs, 0.0, 0.0, 0.0 };
+        if (!scope.history.empty())
+        {
+            sorted = scope.history;
+            std::sort(sorted.begin(), sorted.end());
+
+            double sum = 0.0;
+            for (double ms : sorted)
+                sum += ms;
+
+            // Nearest rank: the smallest sample at or above 99% of them.
+            const size_t rank = (sorted.size() * 99 + 99) / 100;
+            stats.minMs = sorted.front();
+            stats.avgMs = sum / static_cast<double>(sorted.size());
+            stats.p99Ms = sorted[rank - 1];
+        }
+        result.push_back(stats);
+    }
+    return result;
+}
+
+uint32_t GpuProfiler::findScope(const char* name, uint32_t depth)
+{
+    for (uint32_t i = 0; i < scopes.size(); i++)
+    {
+        if (scopes[i].depth == depth && scopes[i].name == name)
+            return i;
+    }
+
+    Scope scope;
+    scope.name = name;
+    scope.depth = depth;
+    scopes.push_back(std::move(scope));
+    return static_cast<uint32_t>(scopes.size() - 1);
+}
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "FrameSync.h"
+
+// Named GPU time ranges of a frame, from timestamp queries. The backend writes
+// a timestamp to every query beginScope() and endScope() hand out, resolves
+// the frame's queries into a readback buffer at its end, and passes them to
+// collect() once the slot comes around again. By then the frame is done, so
+// reading the results never waits for the GPU. Only for the render thread.
+class GpuProfiler
+{
+public:
+    static constexpr uint32_t MaxScopesPerFrame = 32;
+    static constexpr uint32_t QueriesPerFrame = 2 * MaxScopesPerFrame;
+    static constexpr uint32_t InvalidQuery = UINT32_MAX;
+    // Frames kept per scope for the min, average and 99th percentile.
+    static constexpr uint32_t HistorySize = 240;
+
+    struct ScopeStats
+    {
+        std::string name;
+        // Nesting level, 0 for the outermost scopes.
+        uint32_t depth;
+        uint32_t samples;
+        double lastMs;
+        double minMs;
+        double avgMs;
+        double p99Ms;
+    };
+
+    explicit GpuProfiler(uint32_t framesInFlight = FrameSync::MaxFramesInFlight);
+
+    // Size of the query heap and, in timestamps, of the readback buffer. Each
+    // frame slot owns QueriesPerFrame of them.
+    uint32_t getQueryCount() const { return framesInFlight * QueriesPerFrame; }
+
+    void beginFrame(uint32_t slot);
+    // Queries to write a timestamp to. Past MaxScopesPerFrame scopes they
+    // return InvalidQuery and the scope is not measured.
+    uint32_t beginScope(const char* name);
+    uint32_t endScope();
+    // The queries the current frame used, to resolve at its end.
+    uint32_t getFrameFirstQuery() const { return slot * QueriesPerFrame; }
+    uint32_t getFrameQueryCount() const { return 2 * static_cast<uint32_t>(frames[slot].size()); }
+
+    // timestamps holds the slot's QueriesPerFrame values, frequency is in
+    // ticks per second. Does nothing if the slot has no frame to collect.
+    void collect(uint32_t slot, const uint64_t* timestamps, uint64_t frequency);
+
+    // In the order the scopes first appeared.
+    std::vector<ScopeStats> getStats() const;
+
+private:
+    struct FrameScope
+    {
+        uint32_t scope;
+        bool closed;
+    };
+
+    struct Scope
+    {
+        std::string name;
+        uint32_t depth;
+        // Ring of the last HistorySize durations.
+        std::vector<double> history;
+        uint32_t next = 0;
+        double lastMs = 0.0;
+    };
+
+    uint32_t framesInFlight;
+    uint32_t slot = 0;
+    std::vector<FrameScope> frames[FrameSync::MaxFramesInFlight];
+    // Scopes of the current frame that are still open, innermost last.
+    std::vector<uint32_t> openScopes;
+    std::vector<Scope> scopes;
+
+    uint32_t findScope(const char* name, uint32_t depth);
+};
@@ -0,0 +1,252 @@
+#include "HeapAllocator.h"
+
+#include <algorithm>
+#include <bit>
+
+namespace
+{
+    inline uint64_t alignUp(uint64_t value, uint64_t alignment)
+    {
+        return (value + alignment - 1) & ~(alignment - 1);
+    }
+}
+
+HeapAllocator::HeapAllocator(uint64_t size) :
+    size(size & ~(MinBlockSize - 1))
+{
+    for (auto& lists : freeLists)
+        std::fill(std::begin(lists), std::end(lists), InvalidBlock);
+
+    firstBlock = newBlock();
+    Block& block = blocks[firstBlock];
+    block.offset = 0;
+    block.size = this->size;
+    block.prevPhysical = InvalidBlock;
+    block.nextPhysical = InvalidBlock;
+    insertFree(firstBlock);
+}
+
+void HeapAllocator::mapping(uint64_t units, uint32_t& firstLevel, uint32_t& secondLevel)
+{
+    if (units < SecondLevelCount)
+    {
+        firstLevel = 0;
+        secondLevel = static_cast<uint32_t>(units);
+        return;
+    }
+
+    const uint32_t topBit = static_cast<uint32_t>(std::bit_width(units)) - 1;
+    firstLevel = topBit - SecondLevelBits + 1;
+    secondLevel = static_cast<uint32_t>(units >> (topBit - SecondLevelBits)) - SecondLevelCount;
+}
+
+uint32_t HeapAllocator::newBlock()
+{
+    uint32_t index;
+    if (!unusedBlocks.empty())
+    {
+        index = unusedBlocks.back();
+        unusedBlocks.pop_back();
+    }
+    else
+    {
+        index = static_cast<uint32_t>(blocks.size());
+        blocks.emplace_back();
+    }
+
+    blocks[index] = Block();
+    blocks[index].prevFree = InvalidBlock;
+    blocks[index].nextFree = InvalidBlock;
+    return index;
+}
+
+void HeapAllocator::insertFree(uint32_t index)
+{
+    Block& block = blocks[index];
+    uint32_t firstLevel, secondLevel;
+    mapping(block.size / MinBlockSize, firstLevel, secondLevel);
+
+    block.free = true;
+    block.prevFree = InvalidBlock;
+    block.nextFree = freeLists[firstLevel][secondLevel];
+    if (block.nextFree != InvalidBlock)
+        blocks[block.nextFree].prevFree = index;
+    freeLists[firstLevel][secondLevel] = index;
+
+    firstLevelMap |= 1ull << firstLevel;
+    secondLevelMaps[firstLevel] |= 1u << secondLevel;
+}
+
+void HeapAllocator::removeFree(uint32_t index)
+{
+    Block& block = blocks[index];
+    uint32_t firstLevel, secondLevel;
+    mapping(block.size / MinBlockSize, firstLevel, secondLevel);
+
+    if (block.prevFree != InvalidBlock)
+        blocks[block.prevFree].nextFree = block.nextFree;
+    else
+        freeLists[firstLevel][secondLevel] = block.nextFree;
+    if (block.nextFree != InvalidBlock)
+        blocks[block.nextFree].prevFree = block.prevFree;
+
+    if (freeLists[firstLevel][secondLevel] == InvalidBlock)
+    {
+        secondLevelMaps[firstLevel] &= ~(1u << secondLevel);
+        if (secondLevelMaps[firstLevel] == 0)
+            firstLevelMap &= ~(1ull << firstLevel);
+    }
+
+    block.free = false;
+    block.prevFree = InvalidBlock;
+    block.nextFree = InvalidBlock;
+}
+
+uint32_t HeapAllocator::findFree(uint64_t units)
+{
+    // Round up to the next list boundary, so any block in the list found fits.
+    if (units >= SecondLevelCount)
+    {
+        const uint32_t topBit = static_cast<uint32_t>(std::bit_width(units)) - 1;
+        units += (1ull << (topBit - SecondLevelBits)) - 1;
+    }
+
+    uint32_t firstLevel, secondLevel;
+    mapping(units, firstLevel, secondLevel);
+    if (firstLevel >= FirstLevelCount)
+        return InvalidBlock;
+
+    uint32_t secondLevelMap = secondLevelMaps[firstLevel] & (~0u << secondLevel);
+    if (secondLevelMap == 0)
+    {
+        const uint64_t firstLevelMapAbove = firstLevelMap & (~0ull << (firstLevel + 1));
+        if (firstLevelMapAbove == 0)
+            return InvalidBlock;
+
+        firstLevel = static_cast<uint32_t>(std::countr_zero(firstLevelMapAbove));
+        secondLevelMap = secondLevelMaps[firstLevel];
+    }
+
+    return freeLists[firstLevel][std::countr_zero(secondLevelMap)];
+}
+
+uint32_t HeapAllocator::findFreeInClass(uint64_t size, uint64_t alignment) const
+{
+    uint32_t firstLevel, secondLevel;
+    mapping(size / MinBlockSize, firstLevel, secondLevel);
+    if (firstLevel >= FirstLevelCount)
+        return InvalidBlock;
+
+    for (uint32_t i = freeLists[firstLevel][secondLevel]; i != InvalidBlock; i = blocks[i].nextFree)
+    {
+        const uint64_t padding = alignUp(blocks[i].offset, alignment) - blocks[i].offset;
+        if (padding + size <= blocks[i].size)
+            return i;
+    }
+    return InvalidBlock;
+}
+
+uint32_t HeapAllocator::split(uint32_t index, uint64_t firstSize)
+{
+    const uint32_t rest = newBlock();
+    Block& block = blocks[index];
+    Block& restBlock = blocks[rest];
+
+    restBlock.offset = block.offset + firstSize;
+    restBlock.size = block.size - firstSize;
+    restBlock.prevPhysical = index;
+    restBlock.nextPhysical = block.nextPhysical;
+    if (block.nextPhysical != InvalidBlock)
+        blocks[block.nextPhysical].prevPhysical = rest;
+
+    block.size = firstSize;
+    block.nextPhysical = rest;
+    return rest;
+}
+
+void HeapAllocator::merge(uint32_t index, uint32_t next)
+{
+    Block& block = blocks[index];
+    const Block& nextBlock = blocks[next];
+
+    block.size += nextBlock.size;
+    block.nextPhysical = nextBlock.nextPhysical;
+    if (nextBlock.nextPhysical != InvalidBlock)
+        blocks[nextBlock.nextPhysical].prevPhysical = index;
+
+    unusedBlocks.push_back(next);
+}
+
+HeapAllocator::Allocation HeapAllocator::allocate(uint64_t size, uint64_t alignment, uint64_t owner)
+{
+    size = alignUp(std::max<uint64_t>(size, 1), MinBlockSize);
+    alignment = std::max(alignment, MinBlockSize);
+
+    // Room for the worst case padding in front of an aligned offset.
+    const uint64_t units = (size + alignment - MinBlockSize) / MinBlockSize;
+    uint32_t index = findFree(units);
+    if (index == InvalidBlock)
+        index = findFreeInClass(size, alignment);
+    if (index == InvalidBlock)
+        return Allocation();
+
+    removeFree(index);
+
+    const uint64_t padding = alignUp(blocks[index].offset, alignment) - blocks[index].offset;
+    if (padding > 0)
+    {
+        const uint32_t rest = split(index, padding);
+        insertFree(index);
+        index = rest;
+    }
+
+    if (blocks[index].size > size)
+        insertFree(split(index, size));
+
+    Block& block = blocks[index];
+    block.free = false;
+    block.alignment = alignment;
+    block.owner = owner;
+
+    usedSize += block.size;
+    allocationCount++;
+    return { index, block.offset, block.size, alignment };
+}
+
+void HeapAllocator::free(uint32_t index)
+{
+    usedSize -= blocks[index].size;
+    allocationCount--;
+    blocks[index].owner = 0;
+
+    const uint32_t next = blocks[index].nextPhysical;
+    if (next != InvalidBlock && blocks[next].free)
+    {
+        removeFree(next);
+        merge(index, next);
+    }
+
+    const uint32_t prev = blocks[index].prevPhysical;
+    if (prev != InvalidBlock && blocks[prev].free)
+    {
+        removeFree(prev);
+        merge(prev, index);
+        index = prev;
+    }
+
+    insertFree(index);
+}
+
+HeapAllocator::Stats HeapAllocator::getStats() const
+{
+    Stats stats = { size, usedSize, allocationCount, 0, 0 };
+    for (uint32_t i = firstBlock; i != InvalidBlock; i = blocks[i].nextPhysical)
+    {
+        if (blocks[i].free)
+        {
+            stats.freeBlockCount++;
+            stats.largestFreeBlock = std::max(stats.largestFreeBlock, blocks[i].size);
+        }
+    }
+    return stats;
+}
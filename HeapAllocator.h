@@ -0,0 +1,101 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+// Two-level segregated fit (TLSF) allocator over an abstract range of bytes,
+// typically one ID3D12Heap. It only hands out offsets; allocation and free
+// are O(1) and neighbouring free blocks are merged right away. All offsets
+// and sizes are multiples of MinBlockSize.
+class HeapAllocator
+{
+public:
+    static constexpr uint64_t MinBlockSize = 256;
+    static constexpr uint32_t InvalidBlock = UINT32_MAX;
+
+    struct Allocation
+    {
+        uint32_t block = InvalidBlock;
+        uint64_t offset = 0;
+        uint64_t size = 0;
+        uint64_t alignment = 0;
+
+        bool isValid() const { return block != InvalidBlock; }
+    };
+
+    struct Stats
+    {
+        uint64_t size;
+        uint64_t usedSize;
+        uint32_t allocationCount;
+        uint32_t freeBlockCount;
+        uint64_t largestFreeBlock;
+    };
+
+    explicit HeapAllocator(uint64_t size);
+
+    // alignment has to be a power of two. owner is kept with the block and
+    // reported back by forEachAllocation, e.g. to find the resource to move.
+    Allocation allocate(uint64_t size, uint64_t alignment, uint64_t owner = 0);
+    void free(uint32_t block);
+
+    uint64_t getSize() const { return size; }
+    uint64_t getUsedSize() const { return usedSize; }
+    uint32_t getAllocationCount() const { return allocationCount; }
+    bool isEmpty() const { return allocationCount == 0; }
+    Stats getStats() const;
+
+    template <typename Function>
+    void forEachAllocation(Function function) const
+    {
+        for (uint32_t i = firstBlock; i != InvalidBlock; i = blocks[i].nextPhysical)
+        {
+            if (!blocks[i].free)
+                function(Allocation{ i, blocks[i].offset, blocks[i].size, blocks[i].alignment }, blocks[i].owner);
+        }
+    }
+
+private:
+    static constexpr uint32_t SecondLevelBits = 5;
+    static constexpr uint32_t SecondLevelCount = 1u << SecondLevelBits;
+    static constexpr uint32_t FirstLevelCount = 40;
+
+    struct Block
+    {
+        uint64_t offset;
+        uint64_t size;
+        uint64_t alignment;
+        uint64_t owner;
+        uint32_t prevPhysical;
+        uint32_t nextPhysical;
+        uint32_t prevFree;
+        uint32_t nextFree;
+        bool free;
+    };
+
+    uint64_t size;
+    uint64_t usedSize = 0;
+    uint32_t allocationCount = 0;
+
+    std::vector<Block> blocks;
+    std::vector<uint32_t> unusedBlocks;
+    uint32_t firstBlock;
+
+    uint64_t firstLevelMap = 0;
+    uint32_t secondLevelMaps[FirstLevelCount] = {};
+    uint32_t freeLists[FirstLevelCount][SecondLevelCount];
+
+    static void mapping(uint64_t units, uint32_t& firstLevel, uint32_t& secondLevel);
+
+    uint32_t newBlock();
+    void insertFree(uint32_t block);
+    void removeFree(uint32_t block);
+    uint32_t findFree(uint64_t units);
+    // Fallback for requests close to a free block's size, which findFree()
+    // rounds past: searches the size's own list block by block.
+    uint32_t findFreeInClass(uint64_t size, uint64_t alignment) const;
+    // Keeps the first firstSize bytes in block and returns a new block with
+    // the rest.
+    uint32_t split(uint32_t block, uint64_t firstSize);
+    void merge(uint32_t block, uint32_t next);
+};
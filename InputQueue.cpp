@@ -0,0 +1,105 @@
+#include "InputQueue.h"
+
+#include <algorithm>
+
+bool InputQueue::push(const InputEvent& event)
+{
+    const uint32_t slot = tail.load(std::memory_order_relaxed);
+    if (slot - head.load(std::memory_order_acquire) == Capacity)
+    {
+        dropped.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    events[slot % Capacity] = event;
+    tail.store(slot + 1, std::memory_order_release);
+    return true;
+}
+
+bool InputQueue::peek(InputEvent& event) const
+{
+    const uint32_t slot = head.load(std::memory_order_relaxed);
+    if (slot == tail.load(std::memory_order_acquire))
+        return false;
+
+    event = events[slot % Capacity];
+    return true;
+}
+
+void InputQueue::pop()
+{
+    head.store(head.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+}
+
+void InputState::consume(InputQueue& queue, uint64_t time)
+{
+    InputEvent event;
+    while (queue.peek(event) && event.time <= time)
+    {
+        queue.pop();
+
+        switch (event.type)
+        {
+        case InputEventType::KeyDown:
+            if (event.key < KeyCount)
+            {
+                down[event.key] = true;
+                pressed[event.key] = true;
+            }
+            break;
+        case InputEventType::KeyUp:
+            if (event.key < KeyCount)
+                down[event.key] = false;
+            break;
+        case InputEventType::MouseMove:
+            mouseX += event.dx;
+            mouseY += event.dy;
+            break;
+        case InputEventType::ReleaseAll:
+            std::fill(std::begin(down), std::end(down), false);
+            break;
+        }
+
+        if (frameEvents == 0)
+            frameOldest = event.time;
+        frameEvents++;
+        frameTimeSum += event.time;
+    }
+}
+
+void InputState::clearPressed()
+{
+    std::fill(std::begin(pressed), std::end(pressed), false);
+}
+
+void InputState::takeMouseDelta(int32_t& dx, int32_t& dy)
+{
+    dx = mouseX;
+    dy = mouseY;
+    mouseX = 0;
+    mouseY = 0;
+}
+
+void InputState::finishFrame(uint64_t time)
+{
+    if (frameEvents == 0)
+        return;
+
+    // Events come in order, so the oldest waited the longest.
+    const double sumMs = static_cast<double>(frameEvents * time - frameTimeSum) * 1e-6;
+    latencyEvents += frameEvents;
+    latencySumMs += sumMs;
+    lastLatencyMs = sumMs / static_cast<double>(frameEvents);
+    maxLatencyMs = std::max(maxLatencyMs, static_cast<double>(time - frameOldest) * 1e-6);
+
+    frameEvents = 0;
+    frameTimeSum = 0;
+}
+
+InputState::LatencyStats InputState::getLatencyStats() const
+{
+    LatencyStats stats = { latencyEvents, lastLatencyMs, 0.0, maxLatencyMs };
+    if (latencyEvents > 0)
+        stats.avgMs = latencySumMs / static_cast<double>(latencyEvents);
+    return stats;
+}
@@ -0,0 +1,102 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+enum class InputEventType
+{
+    KeyDown,
+    KeyUp,
+    // Relative movement from raw mouse input, in counts.
+    MouseMove,
+    // Every key counts as released, e.g. when the window loses focus and the
+    // key ups go elsewhere.
+    ReleaseAll
+};
+
+// key is a virtual key code below InputState::KeyCount. time is in
+// nanoseconds, on the clock the simulation steps are timed with.
+struct InputEvent
+{
+    InputEventType type;
+    uint32_t key = 0;
+    int32_t dx = 0;
+    int32_t dy = 0;
+    uint64_t time = 0;
+};
+
+// Events from the window procedure on their way to the simulation. One
+// thread pushes, one consumes; neither takes a lock, so raw input could as
+// well come from a thread of its own.
+class InputQueue
+{
+public:
+    static constexpr uint32_t Capacity = 1024;
+
+    // False, and the event is dropped, when the queue is full.
+    bool push(const InputEvent& event);
+    // The oldest event, without removing it.
+    bool peek(InputEvent& event) const;
+    void pop();
+
+    uint64_t getDroppedCount() const { return dropped.load(std::memory_order_relaxed); }
+
+private:
+    InputEvent events[Capacity];
+    // Next event to consume and next free slot; both only grow.
+    std::atomic<uint32_t> head = 0;
+    std::atomic<uint32_t> tail = 0;
+    std::atomic<uint64_t> dropped = 0;
+};
+
+// Keys and mouse as of the last event consumed. The simulation consumes up to
+// the end of each step before running it, so a step sees the keys as they
+// were at its own time rather than at the start of the frame.
+class InputState
+{
+public:
+    static constexpr uint32_t KeyCount = 256;
+
+    struct LatencyStats
+    {
+        uint64_t events;
+        // From an event to the submission of the frame that used it; lastMs
+        // is the average of the last frame that had events.
+        double lastMs;
+        double avgMs;
+        double maxMs;
+    };
+
+    // Applies the queued events stamped at or before time.
+    void consume(InputQueue& queue, uint64_t time);
+
+    bool isKeyDown(uint32_t key) const { return key < KeyCount && down[key]; }
+    // Whether the key went down since clearPressed(), even if it is up again.
+    bool wasKeyPressed(uint32_t key) const { return key < KeyCount && pressed[key]; }
+    void clearPressed();
+
+    // Mouse movement consumed since the last call.
+    void takeMouseDelta(int32_t& dx, int32_t& dy);
+
+    // Call once the frame is submitted: every event consumed since the last
+    // call is counted as having taken until time.
+    void finishFrame(uint64_t time);
+    LatencyStats getLatencyStats() const;
+
+private:
+    bool down[KeyCount] = {};
+    bool pressed[KeyCount] = {};
+    int32_t mouseX = 0;
+    int32_t mouseY = 0;
+
+    // Events consumed this frame: how many, the sum and the oldest of their
+    // times.
+    uint64_t frameEvents = 0;
+    uint64_t frameTimeSum = 0;
+    uint64_t frameOldest = 0;
+
+    uint64_t latencyEvents = 0;
+    double latencySumMs = 0.0;
+    double lastLatencyMs = 0.0;
+    double maxLatencyMs = 0.0;
+};
@@ -0,0 +1,5 @@
+// The instanced variant of VertexShader.hlsl with lighting and with texturing, see the permutations there.
+#define LIT
+#define TEXTURED
+#define INSTANCED
+#include "VertexShader.hlsl"
@@ -0,0 +1,4 @@
+// VertexShader.hlsl with lighting and with texturing, see the permutations there.
+#define LIT
+#define TEXTURED
+#include "VertexShader.hlsl"
@@ -0,0 +1,4 @@
+// The instanced variant of VertexShader.hlsl with lighting and without texturing, see the permutations there.
+#define LIT
+#define INSTANCED
+#include "VertexShader.hlsl"
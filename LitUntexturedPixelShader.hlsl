@@ -0,0 +1,3 @@
+// PixelShader.hlsl with lighting and without texturing, see the permutations there.
+#define LIT
+#include "PixelShader.hlsl"
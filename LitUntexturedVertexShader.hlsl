@@ -0,0 +1,3 @@
+// VertexShader.hlsl with lighting and without texturing, see the permutations there.
+#define LIT
+#include "VertexShader.hlsl"
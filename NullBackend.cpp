@@ -0,0 +1,738 @@
+#include "NullBackend.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <thread>
+
+namespace
+{
+    // Adds everything a command list produces, except the command count.
+    void addWork(NullBackendStats& stats, const NullBackendStats& work)
+    {
+        stats.draws += work.draws;
+        stats.vertices += work.vertices;
+        stats.instances += work.instances;
+        stats.pipelineChanges += work.pipelineChanges;
+        stats.constantBufferChanges += work.constantBufferChanges;
+        stats.materialTableChanges += work.materialTableChanges;
+        stats.materialChanges += work.materialChanges;
+        stats.objectTableChanges += work.objectTableChanges;
+        stats.objectChanges += work.objectChanges;
+        stats.vertexBufferChanges += work.vertexBufferChanges;
+        stats.instanceBufferChanges += work.instanceBufferChanges;
+        stats.bundleExecutions += work.bundleExecutions;
+        stats.indirectCalls += work.indirectCalls;
+    }
+}
+
+NullCommandRecorder::NullCommandRecorder(NullBackendStats& stats, const std::vector<NullBackendStats>& bundles,
+    PipelineCache<uint32_t>& pipelines, bool bundle) :
+    stats(stats),
+    bundles(bundles),
+    pipelines(pipelines),
+    bundle(bundle)
+{
+}
+
+void NullCommandRecorder::setPipeline(PipelineHandle pipeline)
+{
+    pipelines.resolve(pipeline.id - 1, !bundle);
+    stats.pipelineChanges++;
+    stats.commands++;
+}
+
+void NullCommandRecorder::setConstantBuffer(BufferHandle, size_t)
+{
+    stats.constantBufferChanges++;
+    stats.commands++;
+}
+
+void NullCommandRecorder::setMaterialTable(BufferHandle, size_t)
+{
+    stats.materialTableChanges++;
+    stats.commands++;
+}
+
+void NullCommandRecorder::setMaterial(uint32_t)
+{
+    stats.materialChanges++;
+    stats.commands++;
+}
+
+void NullCommandRecorder::setObjectTable(BufferHandle, size_t)
+{
+    stats.objectTableChanges++;
+    stats.commands++;
+}
+
+void NullCommandRecorder::setObject(uint32_t)
+{
+    stats.objectChanges++;
+    stats.commands++;
+}
+
+void NullCommandRecorder::setVertexBuffer(BufferHandle)
+{
+    stats.vertexBufferChanges++;
+    stats.commands++;
+}
+
+void NullCommandRecorder::setInstanceBuffer(BufferHandle, size_t, uint32_t)
+{
+    stats.instanceBufferChanges++;
+    stats.commands++;
+}
+
+void NullCommandRecorder::draw(uint32_t vertexCount, uint32_t instanceCount, uint32_t, uint32_t)
+{
+    stats.draws++;
+    stats.vertices += static_cast<uint64_t>(vertexCount) * instanceCount;
+    stats.instances += instanceCount;
+    stats.commands++;
+}
+
+void NullCommandRecorder::drawIndirect(BufferHandle, size_t, uint32_t drawCount)
+{
+    // The arguments are not read back, so vertices and instances are not
+    // counted.
+    stats.draws += drawCount;
+    stats.indirectCalls++;
+    stats.commands++;
+}
+
+void NullCommandRecorder::executeBundle(BundleHandle bundle)
+{
+    // The bundle's commands were paid for when it was recorded.
+    addWork(stats, bundles[bundle.id - 1]);
+    stats.bundleExecutions++;
+    stats.commands++;
+}
+
+NullBackend::NullBackend(uint32_t framesInFlight) :
+    pipelines(PipelineCompileThreads, [this](const PipelineDesc&, uint64_t hash) { return compilePipeline(hash); }),
+    recorder(stats, bundles, pipelines),
+    bundleRecorder(bundleStats, bundles, pipelines, true),
+    frameSync(framesInFlight),
+    gpuProfiler(framesInFlight)
+{
+    parallelRecorders.reserve(MaxParallelRecorders);
+    for (uint32_t i = 0; i < MaxParallelRecorders; i++)
+        parallelRecorders.emplace_back(parallelStats[i], bundles, pipelines);
+}
+
+void NullBackend::init(uint32_t width, uint32_t height)
+{
+    commandQueue = device.createQueue();
+    fence = device.createFence(0);
+
+    BufferDesc uploadDesc;
+    uploadDesc.size = UploadRingSize;
+    uploadDesc.usage = BufferUsage::Constant;
+    uploadBuffer = createBuffer(uploadDesc);
+    uploadRing.init(UploadRingSize);
+
+    copyQueue = device.createQueue();
+    copyFence = device.createFence(0);
+
+    BufferDesc stagingDesc;
+    stagingDesc.size = UploadStagingSize;
+    stagingBuffer = createBuffer(stagingDesc);
+    uploads.init(UploadStagingSize);
+
+    createTimestampQueries();
+    createDepthBuffer(width, height);
+    createFrameGraph();
+}
+
+// No swap chain to resize, so unlike D3D12Backend nothing waits here.
+void NullBackend::resize(uint32_t width, uint32_t height)
+{
+    createDepthBuffer(width, height);
+}
+
+void NullBackend::destroy()
+{
+    waitForGpu();
+    flushUploads();
+    waitForCopyFenceValue(uploads.getSubmittedFenceValue());
+
+    if (depthBuffer)
+    {
+        releaseQueue.release({ depthBuffer, &targetHeaps, depthBufferAllocation });
+        depthBuffer = 0;
+    }
+    for (uint32_t layer = 0; layer < 2; layer++)
+    {
+        if (shadowMaps[layer])
+            releaseQueue.release({ shadowMaps[layer], &targetHeaps, shadowMapAllocations[layer] });
+        shadowMaps[layer] = 0;
+    }
+    for (uint32_t i = 0; i < buffers.size(); i++)
+        destroyBuffer({ i + 1 });
+    for (const Texture& texture : textures)
+    {
+        device.releaseResource(texture.resource);
+        textureHeaps.allocator.free(texture.allocation);
+    }
+    buffers.clear();
+    textures.clear();
+    releaseQueue.flush([this](ReleasedResource& released) { freeReleasedResource(released); });
+
+    for (HeapPool* pool : { &uploadBufferHeaps, &defaultBufferHeaps, &readbackBufferHeaps, &textureHeaps, &targetHeaps })
+        releaseEmptyHeaps(*pool);
+}
+
+NullBackend::HeapPool& NullBackend::getBufferHeaps(MemoryType memory)
+{
+    return memory == MemoryType::Upload ? uploadBufferHeaps
+        : memory == MemoryType::Readback ? readbackBufferHeaps
+        : defaultBufferHeaps;
+}
+
+uint32_t NullBackend::createPlacedResource(HeapPool& pool, const ResourceDesc& desc, uint64_t owner,
+    GpuMemoryPool::Allocation& allocation)
+{
+    const ResourceAllocationInfo info = device.getResourceAllocationInfo(desc);
+    allocation = pool.allocator.allocate(info.size, info.alignment, owner);
+
+    if (pool.heaps.size() <= allocation.page)
+        pool.heaps.resize(allocation.page + 1, 0);
+    if (pool.heaps[allocation.page] == 0)
+        pool.heaps[allocation.page] = device.createHeap(pool.memory, pool.allocator.getPageSize(allocation.page));
+
+    return device.createPlacedResource(pool.heaps[allocation.page], allocation.offset, desc);
+}
+
+void NullBackend::releaseEmptyHeaps(HeapPool& pool)
+{
+    for (uint32_t page : pool.allocator.releaseEmptyPages())
+    {
+        device.releaseHeap(pool.heaps[page]);
+        pool.heaps[page] = 0;
+    }
+}
+
+uint32_t NullBackend::defragmentMemory(uint32_t maxMoves)
+{
+    waitForGpu();
+    flushUploads();
+    waitForCopyFenceValue(uploads.getSubmittedFenceValue());
+
+    std::vector<uint32_t> oldResources;
+    uint32_t moveCount = 0;
+
+    for (HeapPool* pool : { &uploadBufferHeaps, &defaultBufferHeaps, &readbackBufferHeaps })
+    {
+        for (const GpuMemoryPool::Move& move : pool->allocator.defragment(maxMoves - moveCount))
+        {
+            Buffer& buffer = buffers[move.owner];
+            const ResourceDesc desc = device.getResourceDesc(buffer.resource);
+
+            const uint32_t resource = device.createPlacedResource(pool->heaps[move.to.page], move.to.offset, desc);
+            device.copyBufferRegion(resource, 0, buffer.resource, 0, desc.width);
+
+            oldResources.push_back(buffer.resource);
+            buffer.resource = resource;
+            buffer.allocation = move.to;
+            if (buffer.data)
+                buffer.data = static_cast<uint8_t*>(device.map(resource));
+            moveCount++;
+        }
+    }
+
+    device.executeCommandLists(commandQueue, 0);
+    waitForGpu();
+
+    for (uint32_t resource : oldResources)
+        device.releaseResource(resource);
+    for (HeapPool* pool : { &uploadBufferHeaps, &defaultBufferHeaps, &readbackBufferHeaps })
+        releaseEmptyHeaps(*pool);
+
+    return moveCount;
+}
+
+GpuMemoryPool::Stats NullBackend::getMemoryStats() const
+{
+    GpuMemoryPool::Stats stats = {};
+    for (const HeapPool* pool : { &uploadBufferHeaps, &defaultBufferHeaps, &readbackBufferHeaps, &textureHeaps })
+        stats.add(pool->allocator.getStats());
+    return stats;
+}
+
+void NullBackend::freeReleasedResource(ReleasedResource& released)
+{
+    device.releaseResource(released.resource);
+    released.pool->allocator.free(released.allocation);
+}
+
+void NullBackend::createDepthBuffer(uint32_t width, uint32_t height)
+{
+    ResourceDesc desc;
+    desc.dimension = ResourceDimension::Texture2D;
+    desc.width = width;
+    desc.height = height;
+    desc.bytesPerTexel = 4;
+
+    if (depthBuffer)
+        releaseQueue.release({ depthBuffer, &targetHeaps, depthBufferAllocation });
+    depthBuffer = createPlacedResource(targetHeaps, desc, 0, depthBufferAllocation);
+}
+
+void NullBackend::createShadowMaps(uint32_t size, uint32_t cascadeCount)
+{
+    shadowCascadeCount = cascadeCount;
+
+    ResourceDesc desc;
+    desc.dimension = ResourceDimension::Texture2D;
+    desc.width = size;
+    desc.height = size * cascadeCount;
+    desc.bytesPerTexel = 4;
+    for (uint32_t layer = 0; layer < 2; layer++)
+        shadowMaps[layer] = createPlacedResource(targetHeaps, desc, 0, shadowMapAllocations[layer]);
+
+    createFrameGraph();
+}
+
+void NullBackend::createFrameGraph()
+{
+    for (uint32_t variant = 0; variant < 3; variant++)
+    {
+        RenderGraph& graph = frameGraphs[variant];
+        graph.reset();
+        const uint32_t backBuffer = graph.importResource("BackBuffer", ResourceState::Present, ResourceState::Present);
+        const uint32_t depthBuffer = graph.importResource("DepthBuffer", ResourceState::DepthWrite, ResourceState::DepthWrite);
+        const uint32_t staticShadows = graph.importResource("StaticShadowMaps",
+            ResourceState::CopySource, ResourceState::CopySource);
+        const uint32_t shadows = graph.importResource("ShadowMaps",
+            ResourceState::ShaderResource, ResourceState::ShaderResource);
+
+        staticShadowPass = graph.addPass("StaticShadows");
+        copyShadowPass = graph.addPass("CopyShadows");
+        dynamicShadowPass = graph.addPass("DynamicShadows");
+        scenePass = graph.addPass("Scene");
+
+        if (shadowCascadeCount > 0)
+        {
+            if (variant == StaticShadowsFrame)
+                graph.write(staticShadowPass, staticShadows, ResourceState::DepthWrite);
+            if (variant != CachedShadowsFrame)
+            {
+                graph.read(copyShadowPass, staticShadows, ResourceState::CopySource);
+                graph.write(copyShadowPass, shadows, ResourceState::CopyDest);
+                graph.write(dynamicShadowPass, shadows, ResourceState::DepthWrite);
+            }
+            graph.read(scenePass, shadows, ResourceState::ShaderResource);
+        }
+        graph.write(scenePass, backBuffer, ResourceState::RenderTarget);
+        graph.write(scenePass, depthBuffer, ResourceState::DepthWrite);
+
+        graph.compile();
+    }
+}
+
+void NullBackend::openFrame(uint32_t variant)
+{
+    if (frameOpen)
+        return;
+
+    frameOpen = true;
+    frameVariant = shadowCascadeCount > 0 && !shadowMapsCleared ? StaticShadowsFrame : variant;
+    nextPass = 0;
+    frameStartCommands = stats.commands;
+    frameStartWork = stats.commands + stats.barriers;
+
+    // The frame that last used the slot is done, so its timestamps are in.
+    const uint32_t slot = frameSync.getFrameSlot();
+    const uint64_t* timestamps = static_cast<const uint64_t*>(mapBuffer(timestampBuffer));
+    gpuProfiler.collect(slot, timestamps + slot * GpuProfiler::QueriesPerFrame, 1000000000);
+
+    gpuProfiler.beginFrame(slot);
+    frameTimestamps.assign(GpuProfiler::QueriesPerFrame, 0);
+    writeTimestamp(gpuProfiler.beginScope("Frame"));
+    passScopeOpen = false;
+}
+
+void NullBackend::advanceFrame(uint32_t pass)
+{
+    const RenderGraph& graph = getFrameGraph();
+    for (; nextPass <= pass; nextPass++)
+    {
+        if (graph.isPassCulled(nextPass))
+            continue;
+
+        if (passScopeOpen)
+            writeTimestamp(gpuProfiler.endScope());
+        writeTimestamp(gpuProfiler.beginScope(graph.getPassName(nextPass).c_str()));
+        passScopeOpen = true;
+
+        addBarriers(graph.getBarriers(nextPass));
+        if (nextPass == staticShadowPass)
+            shadowMapsCleared = true;
+        if (nextPass == copyShadowPass)
+            stats.commands++;
+    }
+}
+
+void NullBackend::createTimestampQueries()
+{
+    BufferDesc desc;
+    desc.size = gpuProfiler.getQueryCount() * sizeof(uint64_t);
+    desc.memory = MemoryType::Readback;
+    timestampBuffer = createBuffer(desc);
+}
+
+void NullBackend::writeTimestamp(uint32_t query)
+{
+    if (query != GpuProfiler::InvalidQuery)
+        frameTimestamps[query - gpuProfiler.getFrameFirstQuery()] =
+            (stats.commands + stats.barriers - frameStartWork) * commandGpuTime;
+}
+
+void NullBackend::addBarriers(const std::vector<RenderGraphBarrier>& barriers)
+{
+    if (barriers.empty())
+        return;
+
+    stats.barriers += barriers.size();
+    stats.barrierBatches++;
+}
+
+uint64_t NullBackend::executeGraph(const RenderGraph& graph)
+{
+    const uint64_t heapSize = graph.getTransientHeapSize();
+    const uint32_t heap = heapSize ? device.createHeap(MemoryType::Default, heapSize) : 0;
+
+    std::vector<uint32_t> transients;
+    for (uint32_t resource = 0; resource < graph.getResourceCount(); resource++)
+    {
+        if (!graph.isTransient(resource) || graph.getTransientOffset(resource) == RenderGraph::InvalidOffset)
+            continue;
+
+        ResourceDesc desc;
+        desc.width = graph.getTransientSize(resource);
+        transients.push_back(device.createPlacedResource(heap, graph.getTransientOffset(resource), desc));
+    }
+
+    for (uint32_t pass = 0; pass < graph.getPassCount(); pass++)
+    {
+        if (!graph.isPassCulled(pass))
+            addBarriers(graph.getBarriers(pass));
+    }
+    addBarriers(graph.getFinalBarriers());
+
+    for (uint32_t resource : transients)
+        device.releaseResource(resource);
+    if (heap)
+        device.releaseHeap(heap);
+
+    return heapSize;
+}
+
+BufferHandle NullBackend::createBuffer(const BufferDesc& desc)
+{
+    ResourceDesc resourceDesc;
+    resourceDesc.dimension = ResourceDimension::Buffer;
+    resourceDesc.width = desc.size;
+
+    Buffer buffer = {};
+    buffer.memory = desc.memory;
+    buffer.resource = createPlacedResource(getBufferHeaps(desc.memory), resourceDesc, buffers.size(),
+        buffer.allocation);
+    if (desc.memory == MemoryType::Upload || desc.memory == MemoryType::Readback)
+    {
+        buffer.data = static_cast<uint8_t*>(device.map(buffer.resource));
+        if (desc.memory == MemoryType::Upload && desc.initialData)
+            memcpy(buffer.data, desc.initialData, desc.size);
+    }
+    else if (desc.memory == MemoryType::Default && desc.initialData)
+    {
+        size_t offset;
+        if (allocateStaging(desc.size, ConstantBufferAlignment, offset))
+        {
+            const Buffer& staging = buffers[stagingBuffer.id - 1];
+            memcpy(staging.data + offset, desc.initialData, desc.size);
+            device.copyBufferRegion(buffer.resource, 0, staging.resource, offset, desc.size);
+            buffer.uploadFenceValue = uploads.getBatchFenceValue();
+        }
+        else
+        {
+            buffer.uploadFenceValue = UINT64_MAX;
+        }
+    }
+
+    buffers.push_back(buffer);
+    return { static_cast<uint32_t>(buffers.size()) };
+}
+
+void NullBackend::destroyBuffer(BufferHandle handle)
+{
+    Buffer& buffer = buffers[handle.id - 1];
+    if (buffer.resource == 0)
+        return;
+
+    releaseQueue.release({ buffer.resource, &getBufferHeaps(buffer.memory), buffer.allocation });
+    buffer = Buffer();
+}
+
+void* NullBackend::mapBuffer(BufferHandle buffer)
+{
+    return buffers[buffer.id - 1].data;
+}
+
+TextureHandle NullBackend::createTexture(const TextureDesc& desc)
+{
+    // Same steps as D3D12Backend::createTexture: default heap texture, staging
+    // memory sized by the copyable footprint, row copy, copy queue batch.
+    ResourceDesc textureDesc;
+    textureDesc.dimension = ResourceDimension::Texture2D;
+    textureDesc.width = desc.width;
+    textureDesc.height = desc.height;
+    textureDesc.bytesPerTexel = 4;
+    Texture texture = {};
+    texture.resource = createPlacedResource(textureHeaps, textureDesc, textures.size(), texture.allocation);
+
+    SubresourceFootprint layout;
+    const uint64_t size = device.getCopyableFootprints(textureDesc, 0, 1, 0, &layout);
+    size_t offset;
+    if (!allocateStaging(static_cast<size_t>(size), NullDevice::TextureDataPlacementAlignment, offset))
+    {
+        texture.uploadFenceValue = UINT64_MAX;
+        textures.push_back(texture);
+        return { static_cast<uint32_t>(textures.size()) };
+    }
+    layout.offset += offset;
+
+    const Buffer& staging = buffers[stagingBuffer.id - 1];
+    for (uint32_t y = 0; y < layout.numRows; y++)
+    {
+        memcpy(staging.data + layout.offset + static_cast<uint64_t>(layout.rowPitch) * y,
+            desc.pixels + static_cast<size_t>(desc.width) * 4 * y,
+            static_cast<size_t>(layout.rowSizeInBytes));
+    }
+
+    device.copyTextureRegion(texture.resource, 0, staging.resource, layout);
+    texture.uploadFenceValue = uploads.getBatchFenceValue();
+
+    textures.push_back(texture);
+    return { static_cast<uint32_t>(textures.size()) };
+}
+
+bool NullBackend::isBufferReady(BufferHandle buffer)
+{
+    return buffers[buffer.id - 1].uploadFenceValue <= device.getCompletedValue(copyFence);
+}
+
+bool NullBackend::isTextureReady(TextureHandle texture)
+{
+    return textures[texture.id - 1].uploadFenceValue <= device.getCompletedValue(copyFence);
+}
+
+void NullBackend::flushUploads()
+{
+    uploads.retire(device.getCompletedValue(copyFence));
+    if (!uploads.hasOpenBatch())
+        return;
+
+    const uint64_t bytes = uploads.getStats().bytes - submittedUploadBytes;
+    submittedUploadBytes = uploads.getStats().bytes;
+    device.executeCommandLists(copyQueue, bytes * copyGpuTime / (1024 * 1024));
+    device.signal(copyQueue, copyFence, uploads.submitBatch());
+}
+
+bool NullBackend::allocateStaging(size_t size, size_t alignment, size_t& offset)
+{
+    while (!uploads.allocateStaging(size, alignment, offset))
+    {
+        if (uploads.hasOpenBatch())
+        {
+            flushUploads();
+            continue;
+        }
+        if (!uploads.hasPendingBatches())
+            return false;
+
+        waitForCopyFenceValue(uploads.getOldestFenceValue());
+    }
+    return true;
+}
+
+void NullBackend::waitForCopyFenceValue(uint64_t value)
+{
+    if (device.getCompletedValue(copyFence) < value)
+        device.waitForFence(copyFence, value);
+
+    uploads.retire(device.getCompletedValue(copyFence));
+}
+
+PipelineHandle NullBackend::createPipeline(const PipelineDesc& desc)
+{
+    return { pipelines.request(desc) + 1 };
+}
+
+uint32_t NullBackend::compilePipeline(uint64_t hash)
+{
+    {
+        std::lock_guard<std::mutex> lock(pipelineLibraryMutex);
+        if (pipelineLibrary.count(hash))
+        {
+            loadedPipelines++;
+            return ++pipelineObjects;
+        }
+    }
+
+    std::this_thread::sleep_for(std::chrono::nanoseconds(pipelineCompileTime));
+    compiledPipelines++;
+
+    std::lock_guard<std::mutex> lock(pipelineLibraryMutex);
+    pipelineLibrary.insert(hash);
+    return ++pipelineObjects;
+}
+
+std::vector<uint64_t> NullBackend::getPipelineLibrary()
+{
+    std::lock_guard<std::mutex> lock(pipelineLibraryMutex);
+    return std::vector<uint64_t>(pipelineLibrary.begin(), pipelineLibrary.end());
+}
+
+void NullBackend::setPipelineLibrary(const std::vector<uint64_t>& hashes)
+{
+    std::lock_guard<std::mutex> lock(pipelineLibraryMutex);
+    pipelineLibrary.insert(hashes.begin(), hashes.end());
+}
+
+CommandRecorder& NullBackend::beginBundle()
+{
+    bundleStats = NullBackendStats();
+    return bundleRecorder;
+}
+
+BundleHandle NullBackend::endBundle()
+{
+    bundles.push_back(bundleStats);
+    return { static_cast<uint32_t>(bundles.size()) };
+}
+
+CommandRecorder& NullBackend::beginShadowPass(ShadowLayer layer, uint32_t)
+{
+    openFrame(layer == ShadowLayer::Static ? StaticShadowsFrame : DynamicShadowsFrame);
+    advanceFrame(layer == ShadowLayer::Static ? staticShadowPass : dynamicShadowPass);
+    frameDynamicShadows |= layer == ShadowLayer::Dynamic;
+    stats.shadowPasses++;
+    return recorder;
+}
+
+CommandRecorder& NullBackend::beginFrame(const float*)
+{
+    openFrame(shadowLayersMatch ? CachedShadowsFrame : DynamicShadowsFrame);
+    advanceFrame(scenePass);
+
+    writeTimestamp(gpuProfiler.beginScope("Clear"));
+    writeTimestamp(gpuProfiler.endScope());
+    return recorder;
+}
+
+CommandRecorder& NullBackend::beginParallelRecorder(uint32_t index)
+{
+    parallelStats[index] = NullBackendStats();
+    parallelUsed[index] = true;
+    return parallelRecorders[index];
+}
+
+void NullBackend::submitFrame()
+{
+    flushUploads();
+
+    const uint64_t mainCommands = stats.commands - frameStartCommands;
+    uint64_t longestParallel = 0;
+    stats.commandLists++;
+
+    for (uint32_t i = 0; i < MaxParallelRecorders; i++)
+    {
+        if (!parallelUsed[i])
+            continue;
+
+        addWork(stats, parallelStats[i]);
+        stats.commands += parallelStats[i].commands;
+        stats.commandLists++;
+        longestParallel = std::max(longestParallel, parallelStats[i].commands);
+        parallelUsed[i] = false;
+    }
+
+    // Lists run in order, so the parallel ones count towards the last pass.
+    frameStartWork -= stats.commands - frameStartCommands - mainCommands;
+    if (passScopeOpen)
+        writeTimestamp(gpuProfiler.endScope());
+    passScopeOpen = false;
+
+    // Present() runs after the list, where timestamps cannot reach; this
+    // only times the transitions to the present state.
+    writeTimestamp(gpuProfiler.beginScope("FinalBarriers"));
+    addBarriers(getFrameGraph().getFinalBarriers());
+    writeTimestamp(gpuProfiler.endScope());
+    writeTimestamp(gpuProfiler.endScope());
+
+    uint64_t* timestamps = static_cast<uint64_t*>(mapBuffer(timestampBuffer));
+    memcpy(timestamps + gpuProfiler.getFrameFirstQuery(), frameTimestamps.data(),
+        gpuProfiler.getFrameQueryCount() * sizeof(uint64_t));
+
+    frameOpen = false;
+    shadowLayersMatch = !frameDynamicShadows;
+    frameDynamicShadows = false;
+
+    device.advanceCpuTime((mainCommands + longestParallel) * commandCpuTime);
+    device.executeCommandLists(commandQueue, frameGpuTime);
+}
+
+void NullBackend::present()
+{
+    stats.frames++;
+
+    moveToNextFrame();
+}
+
+void NullBackend::waitForPresentSlot()
+{
+    waitForFenceValue(frameSync.getLastFenceValue());
+}
+
+void NullBackend::waitForGpu()
+{
+    const uint64_t value = frameSync.nextFenceValue();
+    device.signal(commandQueue, fence, value);
+    waitForFenceValue(value);
+}
+
+void NullBackend::moveToNextFrame()
+{
+    const uint64_t value = frameSync.endFrame();
+    device.signal(commandQueue, fence, value);
+    uploadRing.finishFrame(value);
+    releaseQueue.finishFrame(value);
+
+    waitForFenceValue(frameSync.getSlotFenceValue());
+}
+
+void NullBackend::waitForFenceValue(uint64_t value)
+{
+    if (device.getCompletedValue(fence) < value)
+        device.waitForFence(fence, value);
+
+    const uint64_t completed = device.getCompletedValue(fence);
+    uploadRing.retire(completed);
+    releaseQueue.retire(completed, [this](ReleasedResource& released) { freeReleasedResource(released); });
+}
+
+UploadAllocation NullBackend::allocateUpload(size_t size, size_t alignment)
+{
+    size_t offset;
+    while (!uploadRing.allocate(size, alignment, offset))
+    {
+        if (!uploadRing.hasPendingFrames())
+            return UploadAllocation();
+
+        waitForFenceValue(uploadRing.getOldestFenceValue());
+    }
+
+    return { uploadBuffer, offset, buffers[uploadBuffer.id - 1].data + offset };
+}
@@ -0,0 +1,310 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <unordered_set>
+#include <vector>
+
+#include "DeferredReleaseQueue.h"
+#include "FrameSync.h"
+#include "GpuMemoryPool.h"
+#include "GpuProfiler.h"
+#include "NullDevice.h"
+#include "PipelineCache.h"
+#include "RenderBackend.h"
+#include "RenderGraph.h"
+#include "UploadManager.h"
+#include "UploadRing.h"
+
+// Counters collected by NullBackend, reset by the caller when needed.
+struct NullBackendStats
+{
+    uint64_t frames = 0;
+    uint64_t draws = 0;
+    uint64_t vertices = 0;
+    uint64_t instances = 0;
+    uint64_t pipelineChanges = 0;
+    uint64_t constantBufferChanges = 0;
+    uint64_t materialTableChanges = 0;
+    uint64_t materialChanges = 0;
+    uint64_t objectTableChanges = 0;
+    uint64_t objectChanges = 0;
+    uint64_t vertexBufferChanges = 0;
+    uint64_t instanceBufferChanges = 0;
+    uint64_t bundleExecutions = 0;
+    uint64_t indirectCalls = 0;
+    uint64_t barriers = 0;
+    uint64_t barrierBatches = 0;
+    uint64_t shadowPasses = 0;
+    uint64_t commands = 0;
+    uint64_t commandLists = 0;
+};
+
+class NullCommandRecorder : public CommandRecorder
+{
+public:
+    NullCommandRecorder(NullBackendStats& stats, const std::vector<NullBackendStats>& bundles,
+        PipelineCache<uint32_t>& pipelines, bool bundle = false);
+
+    void setPipeline(PipelineHandle pipeline) override;
+    void setConstantBuffer(BufferHandle buffer, size_t offset) override;
+    void setMaterialTable(BufferHandle buffer, size_t offset) override;
+    void setMaterial(uint32_t material) override;
+    void setObjectTable(BufferHandle buffer, size_t offset) override;
+    void setObject(uint32_t object) override;
+    void setVertexBuffer(BufferHandle buffer) override;
+    void setInstanceBuffer(BufferHandle buffer, size_t offset, uint32_t instanceCount) override;
+    void draw(uint32_t vertexCount, uint32_t instanceCount,
+        uint32_t firstVertex, uint32_t firstInstance) override;
+    void drawIndirect(BufferHandle buffer, size_t offset, uint32_t drawCount) override;
+    void executeBundle(BundleHandle bundle) override;
+
+private:
+    NullBackendStats& stats;
+    const std::vector<NullBackendStats>& bundles;
+    PipelineCache<uint32_t>& pipelines;
+    bool bundle;
+};
+
+// Backend that accepts every call and does no GPU work. Resources go through
+// NullDevice the same way D3D12Backend creates them, so uploads and fences run
+// on a simulated timeline; used to measure the CPU side of a frame without a
+// device.
+class NullBackend : public RenderBackend
+{
+public:
+    explicit NullBackend(uint32_t framesInFlight = 2);
+
+    void init(uint32_t width, uint32_t height) override;
+    void resize(uint32_t width, uint32_t height) override;
+    void destroy() override;
+
+    BufferHandle createBuffer(const BufferDesc& desc) override;
+    void destroyBuffer(BufferHandle buffer) override;
+    void* mapBuffer(BufferHandle buffer) override;
+    TextureHandle createTexture(const TextureDesc& desc) override;
+    uint32_t getTextureIndex(TextureHandle texture) override { return texture.id - 1; }
+    PipelineHandle createPipeline(const PipelineDesc& desc) override;
+
+    bool isBufferReady(BufferHandle buffer) override;
+    bool isTextureReady(TextureHandle texture) override;
+    void flushUploads() override;
+    const UploadManager& getUploads() const { return uploads; }
+
+    CommandRecorder& beginBundle() override;
+    BundleHandle endBundle() override;
+
+    uint32_t getFramesInFlight() const override { return frameSync.getFramesInFlight(); }
+    uint32_t getFrameSlot() const override { return frameSync.getFrameSlot(); }
+
+    UploadAllocation allocateUpload(size_t size, size_t alignment) override;
+    const UploadRing& getUploadRing() const { return uploadRing; }
+
+    void createShadowMaps(uint32_t size, uint32_t cascadeCount) override;
+    CommandRecorder& beginShadowPass(ShadowLayer layer, uint32_t cascade) override;
+    CommandRecorder& beginFrame(const float clearColor[4]) override;
+
+    uint32_t getMaxParallelRecorders() const override { return MaxParallelRecorders; }
+    CommandRecorder& beginParallelRecorder(uint32_t index) override;
+
+    void submitFrame() override;
+    void present() override;
+
+    bool isTearingSupported() const override { return true; }
+    void setPresentParams(const PresentParams&) override {}
+    // The latency object of a swap chain with a maximum latency of one frame
+    // is signalled once the previous frame is shown; here, once it is done.
+    void waitForPresentSlot() override;
+
+    // Timestamps are synthetic: nanoseconds since the frame started, with
+    // every command and barrier taking setCommandGpuTime().
+    const GpuProfiler* getGpuProfiler() const override { return &gpuProfiler; }
+
+    const NullBackendStats& getStats() const { return stats; }
+    void resetStats() { stats = NullBackendStats(); }
+
+    NullDevice& getDevice() { return device; }
+    // Simulated GPU time of one frame, in nanoseconds.
+    void setFrameGpuTime(uint64_t nanoseconds) { frameGpuTime = nanoseconds; }
+    // Simulated CPU cost of recording one command. Parallel recorders are
+    // charged as if they ran side by side, so only the longest one counts.
+    void setCommandCpuTime(uint64_t nanoseconds) { commandCpuTime = nanoseconds; }
+    // GPU time of one command or barrier, for the synthetic timestamps.
+    void setCommandGpuTime(uint64_t nanoseconds) { commandGpuTime = nanoseconds; }
+    // Simulated copy queue time per megabyte uploaded.
+    void setCopyGpuTime(uint64_t nanosecondsPerMegabyte) { copyGpuTime = nanosecondsPerMegabyte; }
+    // Time the compile threads really spend on a pipeline that is not in the
+    // library, so fallbacks can be seen.
+    void setPipelineCompileTime(uint64_t nanoseconds) { pipelineCompileTime = nanoseconds; }
+
+    // Stand-in for the on-disk pipeline library: the hashes of the pipelines
+    // compiled so far. Pipelines set here before they are created load
+    // instead of compiling, as in a second run.
+    std::vector<uint64_t> getPipelineLibrary();
+    void setPipelineLibrary(const std::vector<uint64_t>& hashes);
+    const PipelineCache<uint32_t>& getPipelineCache() const { return pipelines; }
+    uint32_t getCompiledPipelineCount() const { return compiledPipelines; }
+    uint32_t getLoadedPipelineCount() const { return loadedPipelines; }
+
+    // Compacts the buffer heaps and frees the heaps that end up empty. Waits
+    // for the GPU; pointers from mapBuffer() have to be fetched again, and
+    // bundles that bind a moved buffer keep its old address, so they have
+    // to be recorded again too.
+    uint32_t defragmentMemory(uint32_t maxMoves);
+    GpuMemoryPool::Stats getMemoryStats() const;
+
+    // Creates the graph's transients in one heap of the null device at the
+    // offsets compile() picked, counts the barriers of its passes and
+    // releases everything again. Returns the heap size.
+    uint64_t executeGraph(const RenderGraph& graph);
+
+private:
+    static constexpr uint32_t MaxParallelRecorders = 8;
+
+    static constexpr uint64_t HeapPageSize = 64 * 1024 * 1024;
+    static constexpr uint32_t PipelineCompileThreads = 2;
+
+    struct HeapPool
+    {
+        MemoryType memory;
+        GpuMemoryPool allocator;
+        std::vector<uint32_t> heaps;
+
+        explicit HeapPool(MemoryType memory) : memory(memory), allocator(HeapPageSize) {}
+    };
+
+    struct Buffer
+    {
+        uint32_t resource;
+        uint8_t* data;
+        MemoryType memory;
+        GpuMemoryPool::Allocation allocation;
+        uint64_t uploadFenceValue;
+    };
+
+    struct Texture
+    {
+        uint32_t resource;
+        GpuMemoryPool::Allocation allocation;
+        uint64_t uploadFenceValue;
+    };
+
+    // Everything the compile threads use is declared before the cache, so
+    // it outlives them.
+    std::mutex pipelineLibraryMutex;
+    std::unordered_set<uint64_t> pipelineLibrary;
+    uint64_t pipelineCompileTime = 0;
+    std::atomic<uint32_t> pipelineObjects = 0;
+    std::atomic<uint32_t> compiledPipelines = 0;
+    std::atomic<uint32_t> loadedPipelines = 0;
+    PipelineCache<uint32_t> pipelines;
+
+    NullBackendStats stats;
+    std::vector<NullBackendStats> bundles;
+    NullCommandRecorder recorder;
+
+    NullBackendStats bundleStats;
+    NullCommandRecorder bundleRecorder;
+
+    NullBackendStats parallelStats[MaxParallelRecorders];
+    std::vector<NullCommandRecorder> parallelRecorders;
+    bool parallelUsed[MaxParallelRecorders] = {};
+
+    NullDevice device;
+    uint32_t commandQueue = 0;
+    uint32_t fence = 0;
+    FrameSync frameSync;
+    uint64_t frameGpuTime = 0;
+    uint64_t commandCpuTime = 0;
+    uint64_t frameStartCommands = 0;
+
+    uint32_t copyQueue = 0;
+    uint32_t copyFence = 0;
+    uint64_t copyGpuTime = 0;
+    uint64_t submittedUploadBytes = 0;
+    BufferHandle stagingBuffer;
+    UploadManager uploads;
+
+    HeapPool uploadBufferHeaps{ MemoryType::Upload };
+    HeapPool defaultBufferHeaps{ MemoryType::Default };
+    HeapPool readbackBufferHeaps{ MemoryType::Readback };
+    HeapPool textureHeaps{ MemoryType::Default };
+    HeapPool targetHeaps{ MemoryType::Default };
+
+    struct ReleasedResource
+    {
+        uint32_t resource;
+        HeapPool* pool;
+        GpuMemoryPool::Allocation allocation;
+    };
+
+    // Same as in D3D12Backend: resources and their memory outlive the frames
+    // that may still use them.
+    DeferredReleaseQueue<ReleasedResource> releaseQueue;
+    uint32_t depthBuffer = 0;
+    GpuMemoryPool::Allocation depthBufferAllocation;
+
+    std::vector<Buffer> buffers;
+    BufferHandle uploadBuffer;
+    UploadRing uploadRing;
+    std::vector<Texture> textures;
+
+    // One array per ShadowLayer. The null device has no arrays, so the
+    // cascades are stacked vertically.
+    uint32_t shadowCascadeCount = 0;
+    uint32_t shadowMaps[2] = {};
+    GpuMemoryPool::Allocation shadowMapAllocations[2];
+    bool shadowMapsCleared = false;
+
+    // Same frame graphs as D3D12Backend; only their barriers are counted.
+    static const uint32_t CachedShadowsFrame = 0;
+    static const uint32_t DynamicShadowsFrame = 1;
+    static const uint32_t StaticShadowsFrame = 2;
+    RenderGraph frameGraphs[3];
+    uint32_t staticShadowPass = 0;
+    uint32_t copyShadowPass = 0;
+    uint32_t dynamicShadowPass = 0;
+    uint32_t scenePass = 0;
+    bool frameOpen = false;
+    uint32_t frameVariant = CachedShadowsFrame;
+    uint32_t nextPass = 0;
+    bool frameDynamicShadows = false;
+    bool shadowLayersMatch = false;
+
+    // Same scopes as in D3D12Backend. Timestamps are kept in
+    // frameTimestamps until submitFrame() "resolves" them into the slot's
+    // part of timestampBuffer.
+    GpuProfiler gpuProfiler;
+    BufferHandle timestampBuffer;
+    std::vector<uint64_t> frameTimestamps;
+    uint64_t commandGpuTime = 0;
+    uint64_t frameStartWork = 0;
+    bool passScopeOpen = false;
+
+    void waitForGpu();
+    void moveToNextFrame();
+    void waitForFenceValue(uint64_t value);
+
+    // False when the data can never fit; the resource then never gets ready.
+    bool allocateStaging(size_t size, size_t alignment, size_t& offset);
+    void waitForCopyFenceValue(uint64_t value);
+
+    HeapPool& getBufferHeaps(MemoryType memory);
+    uint32_t createPlacedResource(HeapPool& pool, const ResourceDesc& desc, uint64_t owner,
+        GpuMemoryPool::Allocation& allocation);
+    void releaseEmptyHeaps(HeapPool& pool);
+    void freeReleasedResource(ReleasedResource& released);
+    void createDepthBuffer(uint32_t width, uint32_t height);
+    // Runs on the compile threads.
+    uint32_t compilePipeline(uint64_t hash);
+
+    void createTimestampQueries();
+    void writeTimestamp(uint32_t query);
+
+    void createFrameGraph();
+    void addBarriers(const std::vector<RenderGraphBarrier>& barriers);
+    void openFrame(uint32_t variant);
+    void advanceFrame(uint32_t pass);
+    const RenderGraph& getFrameGraph() const { return frameGraphs[frameVariant]; }
+};
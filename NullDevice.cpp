@@ -0,0 +1,346 @@
+#include "NullDevice.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace
+{
+    inline uint64_t alignUp(uint64_t value, uint64_t alignment)
+    {
+        return (value + alignment - 1) & ~(alignment - 1);
+    }
+
+    inline uint32_t mipSize(uint64_t size, uint32_t mip)
+    {
+        return static_cast<uint32_t>(std::max<uint64_t>(1, size >> mip));
+    }
+}
+
+NullDevice::NullDevice() :
+    nextGpuAddress(BufferPlacementAlignment)
+{
+}
+
+void NullDevice::record(NullDeviceCall call, uint32_t object, uint64_t value)
+{
+    log.push_back({ call, object, value, cpuTime });
+}
+
+size_t NullDevice::countCalls(NullDeviceCall call) const
+{
+    return static_cast<size_t>(std::count_if(log.begin(), log.end(),
+        [call](const NullDeviceLogEntry& entry) { return entry.call == call; }));
+}
+
+uint32_t NullDevice::createHeap(MemoryType type, uint64_t size)
+{
+    Heap heap;
+    heap.type = type;
+    heap.size = size;
+    heap.gpuAddress = nextGpuAddress;
+    heap.memory.resize(size);
+    nextGpuAddress += alignUp(size, BufferPlacementAlignment) + BufferPlacementAlignment;
+
+    heaps.push_back(std::move(heap));
+    record(NullDeviceCall::CreateHeap, static_cast<uint32_t>(heaps.size()), size);
+    return static_cast<uint32_t>(heaps.size());
+}
+
+void NullDevice::releaseHeap(uint32_t heap)
+{
+    std::vector<uint8_t>().swap(heaps[heap - 1].memory);
+    heaps[heap - 1].size = 0;
+    record(NullDeviceCall::ReleaseHeap, heap, 0);
+}
+
+uint32_t NullDevice::addResource(uint32_t heap, uint64_t offset, const ResourceDesc& desc)
+{
+    Resource resource;
+    resource.desc = desc;
+    resource.heap = heap;
+    resource.offset = offset;
+    resource.size = getResourceAllocationInfo(desc).size;
+    resource.mapCount = 0;
+    resource.committed = false;
+    resource.released = false;
+
+    resources.push_back(resource);
+    return static_cast<uint32_t>(resources.size());
+}
+
+uint32_t NullDevice::createCommittedResource(MemoryType type, const ResourceDesc& desc)
+{
+    // Committed resources get an implicit heap of their own, like on D3D12.
+    Heap heap;
+    heap.type = type;
+    heap.size = getResourceAllocationInfo(desc).size;
+    heap.gpuAddress = nextGpuAddress;
+    heap.memory.resize(heap.size);
+    nextGpuAddress += heap.size + BufferPlacementAlignment;
+    heaps.push_back(std::move(heap));
+
+    const uint32_t resource = addResource(static_cast<uint32_t>(heaps.size()), 0, desc);
+    resources[resource - 1].committed = true;
+
+    record(NullDeviceCall::CreateCommittedResource, resource, resources[resource - 1].size);
+    return resource;
+}
+
+uint32_t NullDevice::createPlacedResource(uint32_t heap, uint64_t offset, const ResourceDesc& desc)
+{
+    const ResourceAllocationInfo info = getResourceAllocationInfo(desc);
+    if (heap == 0 || heap > heaps.size() || offset % info.alignment != 0
+        || offset + info.size > heaps[heap - 1].size)
+    {
+        record(NullDeviceCall::Error, heap, offset);
+        return 0;
+    }
+
+    const uint32_t resource = addResource(heap, offset, desc);
+    record(NullDeviceCall::CreatePlacedResource, resource, offset);
+    return resource;
+}
+
+void NullDevice::releaseResource(uint32_t resource)
+{
+    Resource& r = resources[resource - 1];
+    r.released = true;
+    if (r.committed)
+    {
+        std::vector<uint8_t>().swap(heaps[r.heap - 1].memory);
+    }
+    record(NullDeviceCall::ReleaseResource, resource, 0);
+}
+
+ResourceAllocationInfo NullDevice::getResourceAllocationInfo(const ResourceDesc& desc) const
+{
+    if (desc.dimension == ResourceDimension::Buffer)
+        return { alignUp(desc.width, BufferPlacementAlignment), BufferPlacementAlignment };
+
+    uint64_t size = 0;
+    for (uint32_t mip = 0; mip < desc.mipLevels; mip++)
+    {
+        const uint64_t rowPitch = alignUp(static_cast<uint64_t>(mipSize(desc.width, mip)) * desc.bytesPerTexel,
+            TextureDataPitchAlignment);
+        size += rowPitch * mipSize(desc.height, mip);
+    }
+    return { alignUp(size, TexturePlacementAlignment), TexturePlacementAlignment };
+}
+
+uint64_t NullDevice::getCopyableFootprints(const ResourceDesc& desc, uint32_t firstSubresource,
+    uint32_t numSubresources, uint64_t baseOffset, SubresourceFootprint* layouts) const
+{
+    if (desc.dimension == ResourceDimension::Buffer)
+    {
+        if (layouts)
+        {
+            layouts[0] = { baseOffset, static_cast<uint32_t>(desc.width), 1,
+                static_cast<uint32_t>(alignUp(desc.width, TextureDataPitchAlignment)), 1, desc.width };
+        }
+        return desc.width;
+    }
+
+    uint64_t offset = baseOffset;
+    uint64_t end = baseOffset;
+    for (uint32_t i = 0; i < numSubresources; i++)
+    {
+        const uint32_t mip = firstSubresource + i;
+        SubresourceFootprint footprint;
+        footprint.offset = alignUp(offset, TextureDataPlacementAlignment);
+        footprint.width = mipSize(desc.width, mip);
+        footprint.height = mipSize(desc.height, mip);
+        footprint.rowSizeInBytes = static_cast<uint64_t>(footprint.width) * desc.bytesPerTexel;
+        footprint.rowPitch = static_cast<uint32_t>(alignUp(footprint.rowSizeInBytes, TextureDataPitchAlignment));
+        footprint.numRows = footprint.height;
+
+        if (layouts)
+            layouts[i] = footprint;
+
+        end = footprint.offset + static_cast<uint64_t>(footprint.rowPitch) * (footprint.numRows - 1)
+            + footprint.rowSizeInBytes;
+        offset = footprint.offset + static_cast<uint64_t>(footprint.rowPitch) * footprint.numRows;
+    }
+    return end - baseOffset;
+}
+
+void* NullDevice::map(uint32_t resource)
+{
+    Resource& r = resources[resource - 1];
+    if (r.released || heaps[r.heap - 1].type == MemoryType::Default)
+    {
+        record(NullDeviceCall::Error, resource, 0);
+        return nullptr;
+    }
+
+    r.mapCount++;
+    record(NullDeviceCall::Map, resource, r.mapCount);
+    return heaps[r.heap - 1].memory.data() + r.offset;
+}
+
+void NullDevice::unmap(uint32_t resource)
+{
+    Resource& r = resources[resource - 1];
+    if (r.mapCount == 0)
+    {
+        record(NullDeviceCall::Error, resource, 0);
+        return;
+    }
+
+    r.mapCount--;
+    record(NullDeviceCall::Unmap, resource, r.mapCount);
+}
+
+uint64_t NullDevice::getGpuVirtualAddress(uint32_t resource) const
+{
+    const Resource& r = resources[resource - 1];
+    return heaps[r.heap - 1].gpuAddress + r.offset;
+}
+
+const ResourceDesc& NullDevice::getResourceDesc(uint32_t resource) const
+{
+    return resources[resource - 1].desc;
+}
+
+uint8_t* NullDevice::getMemory(uint32_t resource)
+{
+    const Resource& r = resources[resource - 1];
+    return heaps[r.heap - 1].memory.data() + r.offset;
+}
+
+void NullDevice::copyBufferRegion(uint32_t dst, uint64_t dstOffset, uint32_t src, uint64_t srcOffset, uint64_t size)
+{
+    if (dstOffset + size > resources[dst - 1].desc.width || srcOffset + size > resources[src - 1].desc.width)
+    {
+        record(NullDeviceCall::Error, dst, size);
+        return;
+    }
+
+    memcpy(getMemory(dst) + dstOffset, getMemory(src) + srcOffset, size);
+    record(NullDeviceCall::CopyBufferRegion, dst, size);
+}
+
+void NullDevice::copyTextureRegion(uint32_t dst, uint32_t subresource, uint32_t src, const SubresourceFootprint& footprint)
+{
+    // The texture's own memory uses the same row layout as an upload footprint.
+    const ResourceDesc& desc = resources[dst - 1].desc;
+    if (subresource >= desc.mipLevels)
+    {
+        record(NullDeviceCall::Error, dst, subresource);
+        return;
+    }
+
+    std::vector<SubresourceFootprint> layouts(subresource + 1);
+    getCopyableFootprints(desc, 0, subresource + 1, 0, layouts.data());
+    const SubresourceFootprint& layout = layouts[subresource];
+
+    uint8_t* dstMemory = getMemory(dst);
+    const uint8_t* srcMemory = getMemory(src);
+    const uint32_t rows = std::min(layout.numRows, footprint.numRows);
+    const uint64_t rowSize = std::min(layout.rowSizeInBytes, footprint.rowSizeInBytes);
+    for (uint32_t row = 0; row < rows; row++)
+    {
+        memcpy(dstMemory + layout.offset + static_cast<uint64_t>(row) * layout.rowPitch,
+            srcMemory + footprint.offset + static_cast<uint64_t>(row) * footprint.rowPitch,
+            rowSize);
+    }
+    record(NullDeviceCall::CopyTextureRegion, dst, subresource);
+}
+
+uint32_t NullDevice::createQueue()
+{
+    queueTimes.push_back(0);
+    return static_cast<uint32_t>(queueTimes.size());
+}
+
+uint32_t NullDevice::createFence(uint64_t initialValue)
+{
+    fences.push_back(initialValue);
+    return static_cast<uint32_t>(fences.size());
+}
+
+void NullDevice::executeCommandLists(uint32_t queue, uint64_t gpuTime)
+{
+    uint64_t& queueTime = queueTimes[queue - 1];
+    queueTime = std::max(queueTime, cpuTime) + gpuTime;
+    record(NullDeviceCall::ExecuteCommandLists, queue, gpuTime);
+}
+
+void NullDevice::signal(uint32_t queue, uint32_t fence, uint64_t value)
+{
+    uint64_t& queueTime = queueTimes[queue - 1];
+    queueTime = std::max(queueTime, cpuTime);
+    pendingSignals.push_back({ queueTime, fence, value });
+    record(NullDeviceCall::Signal, fence, value);
+}
+
+void NullDevice::queueWait(uint32_t queue, uint32_t fence, uint64_t value)
+{
+    record(NullDeviceCall::QueueWait, fence, value);
+    if (getCompletedValue(fence) >= value)
+        return;
+
+    uint64_t time = 0;
+    if (!findSignalTime(fence, value, time))
+    {
+        record(NullDeviceCall::Error, fence, value);
+        return;
+    }
+
+    uint64_t& queueTime = queueTimes[queue - 1];
+    queueTime = std::max(queueTime, time);
+}
+
+uint64_t NullDevice::getCompletedValue(uint32_t fence)
+{
+    retireSignals();
+    return fences[fence - 1];
+}
+
+bool NullDevice::waitForFence(uint32_t fence, uint64_t value)
+{
+    if (getCompletedValue(fence) >= value)
+    {
+        record(NullDeviceCall::CpuWait, fence, 0);
+        return true;
+    }
+
+    uint64_t time = 0;
+    if (!findSignalTime(fence, value, time))
+    {
+        record(NullDeviceCall::Error, fence, value);
+        return false;
+    }
+
+    const uint64_t stall = time - cpuTime;
+    stallTime += stall;
+    cpuTime = time;
+    retireSignals();
+    record(NullDeviceCall::CpuWait, fence, stall);
+    return true;
+}
+
+bool NullDevice::findSignalTime(uint32_t fence, uint64_t value, uint64_t& time) const
+{
+    bool found = false;
+    for (const PendingSignal& signal : pendingSignals)
+    {
+        if (signal.fence == fence && signal.value >= value && (!found || signal.time < time))
+        {
+            time = signal.time;
+            found = true;
+        }
+    }
+    return found;
+}
+
+void NullDevice::retireSignals()
+{
+    auto retired = std::remove_if(pendingSignals.begin(), pendingSignals.end(),
+        [this](const PendingSignal& signal) {
+            if (signal.time > cpuTime)
+                return false;
+            fences[signal.fence - 1] = std::max(fences[signal.fence - 1], signal.value);
+            return true;
+        });
+    pendingSignals.erase(retired, pendingSignals.end());
+}
@@ -0,0 +1,169 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "RenderBackend.h"
+
+// Host memory stand-in for the parts of ID3D12Device the resource code uses:
+// heaps, committed/placed resources, Map/Unmap, GetCopyableFootprints, copy
+// queues and fences. GPU work is not executed, it only advances a simulated
+// timeline, so upload and synchronization logic can be run without a GPU.
+
+enum class ResourceDimension
+{
+    Buffer,
+    Texture2D
+};
+
+struct ResourceDesc
+{
+    ResourceDimension dimension = ResourceDimension::Buffer;
+    uint64_t width = 0;
+    uint32_t height = 1;
+    uint16_t mipLevels = 1;
+    uint32_t bytesPerTexel = 0;
+};
+
+// D3D12_PLACED_SUBRESOURCE_FOOTPRINT plus the row information that
+// GetCopyableFootprints returns next to it.
+struct SubresourceFootprint
+{
+    uint64_t offset;
+    uint32_t width;
+    uint32_t height;
+    uint32_t rowPitch;
+    uint32_t numRows;
+    uint64_t rowSizeInBytes;
+};
+
+struct ResourceAllocationInfo
+{
+    uint64_t size;
+    uint64_t alignment;
+};
+
+enum class NullDeviceCall
+{
+    CreateHeap,
+    ReleaseHeap,
+    CreateCommittedResource,
+    CreatePlacedResource,
+    ReleaseResource,
+    Map,
+    Unmap,
+    CopyBufferRegion,
+    CopyTextureRegion,
+    ExecuteCommandLists,
+    Signal,
+    QueueWait,
+    CpuWait,
+    Error
+};
+
+struct NullDeviceLogEntry
+{
+    NullDeviceCall call;
+    uint32_t object;
+    uint64_t value;
+    uint64_t time;
+};
+
+class NullDevice
+{
+public:
+    static const uint64_t BufferPlacementAlignment = 64 * 1024;
+    static const uint64_t TexturePlacementAlignment = 64 * 1024;
+    static const uint32_t TextureDataPitchAlignment = 256;
+    static const uint64_t TextureDataPlacementAlignment = 512;
+
+    NullDevice();
+
+    uint32_t createHeap(MemoryType type, uint64_t size);
+    // Resources placed in the heap must be released first.
+    void releaseHeap(uint32_t heap);
+    uint32_t createCommittedResource(MemoryType type, const ResourceDesc& desc);
+    uint32_t createPlacedResource(uint32_t heap, uint64_t offset, const ResourceDesc& desc);
+    void releaseResource(uint32_t resource);
+
+    ResourceAllocationInfo getResourceAllocationInfo(const ResourceDesc& desc) const;
+    // Fills up to numSubresources layouts (may be null) and returns the total size.
+    uint64_t getCopyableFootprints(const ResourceDesc& desc, uint32_t firstSubresource,
+        uint32_t numSubresources, uint64_t baseOffset, SubresourceFootprint* layouts) const;
+
+    void* map(uint32_t resource);
+    void unmap(uint32_t resource);
+    uint64_t getGpuVirtualAddress(uint32_t resource) const;
+    const ResourceDesc& getResourceDesc(uint32_t resource) const;
+    uint8_t* getMemory(uint32_t resource);
+
+    // Copies are applied immediately on the host; only their timing is simulated.
+    void copyBufferRegion(uint32_t dst, uint64_t dstOffset, uint32_t src, uint64_t srcOffset, uint64_t size);
+    void copyTextureRegion(uint32_t dst, uint32_t subresource, uint32_t src, const SubresourceFootprint& footprint);
+
+    uint32_t createQueue();
+    uint32_t createFence(uint64_t initialValue);
+
+    // Queues work taking gpuTime nanoseconds behind everything already queued.
+    void executeCommandLists(uint32_t queue, uint64_t gpuTime);
+    void signal(uint32_t queue, uint32_t fence, uint64_t value);
+    // GPU side wait: later work on the queue starts after the fence reaches value.
+    void queueWait(uint32_t queue, uint32_t fence, uint64_t value);
+    uint64_t getCompletedValue(uint32_t fence);
+    // CPU side wait, moves the CPU clock to the moment the value is reached.
+    // Returns false when no queued signal can ever satisfy it.
+    bool waitForFence(uint32_t fence, uint64_t value);
+
+    // Simulated CPU work between API calls.
+    void advanceCpuTime(uint64_t nanoseconds) { cpuTime += nanoseconds; }
+    uint64_t getCpuTime() const { return cpuTime; }
+    uint64_t getStallTime() const { return stallTime; }
+
+    const std::vector<NullDeviceLogEntry>& getLog() const { return log; }
+    size_t countCalls(NullDeviceCall call) const;
+    void clearLog() { log.clear(); }
+
+private:
+    struct Heap
+    {
+        MemoryType type;
+        uint64_t size;
+        uint64_t gpuAddress;
+        std::vector<uint8_t> memory;
+    };
+
+    struct Resource
+    {
+        ResourceDesc desc;
+        uint32_t heap;
+        uint64_t offset;
+        uint64_t size;
+        uint32_t mapCount;
+        bool committed;
+        bool released;
+    };
+
+    struct PendingSignal
+    {
+        uint64_t time;
+        uint32_t fence;
+        uint64_t value;
+    };
+
+    std::vector<Heap> heaps;
+    std::vector<Resource> resources;
+    std::vector<uint64_t> queueTimes;
+    std::vector<uint64_t> fences;
+    std::vector<PendingSignal> pendingSignals;
+    std::vector<NullDeviceLogEntry> log;
+
+    uint64_t cpuTime = 0;
+    uint64_t stallTime = 0;
+    uint64_t nextGpuAddress;
+
+    void record(NullDeviceCall call, uint32_t object, uint64_t value);
+    void retireSignals();
+    bool findSignalTime(uint32_t fence, uint64_t value, uint64_t& time) const;
+    uint32_t addResource(uint32_t heap, uint64_t offset, const ResourceDesc& desc);
+};
@@ -0,0 +1,23 @@
+#include "PipelineCache.h"
+
+uint64_t hashBytes(const void* data, size_t size, uint64_t hash)
+{
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+    for (size_t i = 0; i < size; i++)
+    {
+        hash ^= bytes[i];
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+uint64_t hashPipelineDesc(const PipelineDesc& desc, uint64_t seed)
+{
+    const uint32_t program = static_cast<uint32_t>(desc.program);
+    const uint8_t flags[] = {
+        desc.depthTest, desc.depthWrite, desc.cullBackFaces, desc.lit, desc.textured, desc.shadowCaster
+    };
+
+    const uint64_t hash = hashBytes(&program, sizeof(program), seed);
+    return hashBytes(flags, sizeof(flags), hash);
+}
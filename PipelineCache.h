@@ -0,0 +1,240 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "CpuProfiler.h"
+#include "RenderBackend.h"
+
+const uint64_t PipelineHashBasis = 14695981039346656037ull;
+
+// FNV-1a, so the same bytes hash the same in every run and build.
+uint64_t hashBytes(const void* data, size_t size, uint64_t hash = PipelineHashBasis);
+// Hashes the fields one by one, so padding and the compiler do not matter.
+// seed goes into the hash first, e.g. a hash of the shader bytecode, so
+// pipelines stored by an older build are not picked up.
+uint64_t hashPipelineDesc(const PipelineDesc& desc, uint64_t seed = PipelineHashBasis);
+
+// Bookkeeping behind RenderBackend::createPipeline(), without touching an API.
+// Descriptions are deduplicated by their hash and compiled into a T on
+// background threads; until an entry is ready, draws bind the closest
+// compatible entry that is.
+template <typename T>
+class PipelineCache
+{
+public:
+    static constexpr uint32_t InvalidEntry = UINT32_MAX;
+
+    // Runs on a compile thread. hash names the pipeline, e.g. in an on-disk
+    // library.
+    using CompileFunction = std::function<T(const PipelineDesc& desc, uint64_t hash)>;
+
+    struct Stats
+    {
+        uint32_t entries;
+        uint32_t ready;
+        // resolve() calls that bound another entry, or had to wait.
+        uint64_t fallbacks;
+        uint64_t waits;
+    };
+
+    // Without threads, request() compiles right away.
+    PipelineCache(uint32_t threadCount, CompileFunction compile, uint64_t seed = PipelineHashBasis) :
+        compile(std::move(compile)),
+        seed(seed)
+    {
+        for (uint32_t i = 0; i < threadCount; i++)
+            threads.emplace_back(&PipelineCache::workerLoop, this);
+    }
+
+    ~PipelineCache()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        wakeCondition.notify_all();
+        for (std::thread& thread : threads)
+            thread.join();
+    }
+
+    PipelineCache(const PipelineCache&) = delete;
+    PipelineCache& operator=(const PipelineCache&) = delete;
+
+    // The entry for desc; a new one is queued for compilation. Not thread
+    // safe against itself or resolve().
+    uint32_t request(const PipelineDesc& desc)
+    {
+        const uint64_t hash = hashPipelineDesc(desc, seed);
+        const auto found = entryIndex.find(hash);
+        if (found != entryIndex.end())
+            return found->second;
+
+        const uint32_t entry = static_cast<uint32_t>(entries.size());
+        entries.emplace_back(desc, hash);
+        entryIndex.emplace(hash, entry);
+
+        if (threads.empty())
+        {
+            PROFILE_ZONE("CompilePipeline");
+            finish(entries[entry], compile(desc, hash));
+            return entry;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            queue.push_back(&entries[entry]);
+        }
+        wakeCondition.notify_one();
+        return entry;
+    }
+
+    // Entry to bind in place of entry: itself once compiled, otherwise the
+    // ready one with the same input layout and pass type that shares the most
+    // state. Waits for the compile if there is none, or if allowFallback is
+    // false, e.g. for bundles, which keep what they were recorded with; an
+    // entry no thread has started on yet is compiled right here instead.
+    // Thread safe against other resolve() calls and the compile threads.
+    uint32_t resolve(uint32_t entry, bool allowFallback = true)
+    {
+        if (isReady(entry))
+            return entry;
+
+        if (allowFallback)
+        {
+            const uint32_t fallback = findFallback(entry);
+            if (fallback != InvalidEntry)
+            {
+                fallbacks++;
+                return fallback;
+            }
+        }
+
+        waits++;
+        std::unique_lock<std::mutex> lock(mutex);
+        const auto queued = std::find(queue.begin(), queue.end(), &entries[entry]);
+        if (queued != queue.end())
+        {
+            queue.erase(queued);
+            lock.unlock();
+            PROFILE_ZONE("CompilePipeline");
+            finish(entries[entry], compile(entries[entry].desc, entries[entry].hash));
+            return entry;
+        }
+
+        readyCondition.wait(lock, [this, entry] { return isReady(entry); });
+        return entry;
+    }
+
+    bool isReady(uint32_t entry) const { return entries[entry].ready.load(std::memory_order_acquire); }
+    // Only valid once the entry is ready.
+    const T& getObject(uint32_t entry) const { return entries[entry].object; }
+    uint64_t getHash(uint32_t entry) const { return entries[entry].hash; }
+    uint32_t getEntryCount() const { return static_cast<uint32_t>(entries.size()); }
+
+    // Blocks until everything requested so far is compiled.
+    void waitIdle()
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        readyCondition.wait(lock, [this] { return readyCount == entries.size(); });
+    }
+
+    Stats getStats() const
+    {
+        return { static_cast<uint32_t>(entries.size()), readyCount.load(), fallbacks.load(), waits.load() };
+    }
+
+private:
+    struct Entry
+    {
+        PipelineDesc desc;
+        uint64_t hash;
+        T object = T();
+        std::atomic<bool> ready = false;
+
+        Entry(const PipelineDesc& desc, uint64_t hash) : desc(desc), hash(hash) {}
+    };
+
+    CompileFunction compile;
+    uint64_t seed;
+
+    // A deque keeps entries in place while new ones are added.
+    std::deque<Entry> entries;
+    std::unordered_map<uint64_t, uint32_t> entryIndex;
+    std::atomic<uint32_t> readyCount = 0;
+    std::atomic<uint64_t> fallbacks = 0;
+    std::atomic<uint64_t> waits = 0;
+
+    std::vector<std::thread> threads;
+    std::mutex mutex;
+    std::condition_variable wakeCondition;
+    std::condition_variable readyCondition;
+    std::deque<Entry*> queue;
+    bool stopping = false;
+
+    void finish(Entry& entry, T object)
+    {
+        entry.object = std::move(object);
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            entry.ready.store(true, std::memory_order_release);
+            readyCount++;
+        }
+        readyCondition.notify_all();
+    }
+
+    uint32_t findFallback(uint32_t entry) const
+    {
+        const PipelineDesc& desc = entries[entry].desc;
+
+        uint32_t best = InvalidEntry;
+        int bestScore = -1;
+        for (uint32_t i = 0; i < entries.size(); i++)
+        {
+            const PipelineDesc& other = entries[i].desc;
+            if (!isReady(i) || other.program != desc.program || other.shadowCaster != desc.shadowCaster)
+                continue;
+
+            const int score = (other.depthTest == desc.depthTest) + (other.depthWrite == desc.depthWrite)
+                + (other.cullBackFaces == desc.cullBackFaces) + (other.lit == desc.lit)
+                + (other.textured == desc.textured);
+            if (score > bestScore)
+            {
+                best = i;
+                bestScore = score;
+            }
+        }
+        return best;
+    }
+
+    void workerLoop()
+    {
+        PROFILE_THREAD("Pipeline compiler");
+        for (;;)
+        {
+            Entry* entry;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                wakeCondition.wait(lock, [this] { return stopping || !queue.empty(); });
+                if (stopping)
+                    return;
+
+                entry = queue.front();
+                queue.pop_front();
+            }
+
+            PROFILE_ZONE("CompilePipeline");
+            finish(*entry, compile(entry->desc, entry->hash));
+        }
+    }
+};
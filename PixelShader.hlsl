@@ -1,13 +1,78 @@
+// Compiled once per LIT and TEXTURED permutation, see the *PixelShader.hlsl
+// wrappers; the input matches the vertex shader with the same defines.
+
 struct ps_input_t {
 	float4 position : SV_POSITION;
 	float4 color : COLOR;
+#ifdef TEXTURED
 	float2 tex : TEXCOORD;
+#endif
+#ifdef LIT
+	float3 worldPos : WORLDPOS;
+	float viewDepth : VIEWDEPTH;
+	float shadowed : SHADOWED;
+#endif
+};
+
+cbuffer vs_const_buffer_t : register(b0) {
+	float4x4 matViewProj;
+	float4x4 matView;
+
+	float4 colLight;
+	float4 dirLight;
+
+	float4x4 matShadow[4];
+	float4 cascadeSplits;
+	float4 shadowParams;
+
+	float4 padding[4];
+};
+
+cbuffer draw_constants_t : register(b1) {
+	uint materialId;
+	uint objectId;
+};
+
+struct material_t {
+	float4 color;
+	uint textureIndex;
+	uint3 padding;
 };
 
-Texture2D texture_ps;
-SamplerState sampler_ps;
+StructuredBuffer<material_t> materials : register(t0);
+// Every texture in the descriptor heap, indexed by material_t.textureIndex.
+Texture2D textures[] : register(t0, space1);
+SamplerState sampler_ps : register(s0);
+
+// Dynamic shadow layers, one slice per cascade.
+Texture2DArray<float> shadowMap : register(t2);
+SamplerComparisonState shadowSampler : register(s1);
+
+float getShadow(float3 worldPos, float viewDepth)
+{
+	uint cascadeCount = (uint)shadowParams.x;
+	for (uint i = 0; i < cascadeCount; i++)
+	{
+		if (viewDepth < cascadeSplits[i])
+		{
+			float4 shadowPos = mul(float4(worldPos, 1.0f), matShadow[i]);
+			float2 uv = shadowPos.xy * float2(0.5f, -0.5f) + 0.5f;
+			return shadowMap.SampleCmpLevelZero(shadowSampler, float3(uv, i), shadowPos.z - shadowParams.y);
+		}
+	}
+	return 1.0f;
+}
 
 float4 main(ps_input_t input) : SV_TARGET
 {
-	return input.color * texture_ps.Sample(sampler_ps, input.tex);
+	float4 color = input.color;
+#ifdef LIT
+	float shadow = getShadow(input.worldPos, input.viewDepth);
+	color *= 1.0f - input.shadowed * shadowParams.z * (1.0f - shadow);
+#endif
+#ifdef TEXTURED
+	Texture2D texture_ps = textures[materials[materialId].textureIndex];
+	color *= texture_ps.Sample(sampler_ps, input.tex);
+#endif
+	return color;
 }
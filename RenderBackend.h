@@ -0,0 +1,277 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// API independent view of everything the renderer needs from the GPU.
+// Handles are 1-based indices into the backend's own tables, 0 means "none".
+
+// Constant buffer views have to start on a 256 byte boundary.
+const size_t ConstantBufferAlignment = 256;
+
+inline size_t alignConstantSize(size_t size)
+{
+    return (size + ConstantBufferAlignment - 1) & ~(ConstantBufferAlignment - 1);
+}
+
+// Size of the upload ring behind allocateUpload(). Room for 100k instances
+// (InstanceData) in each of the frames in flight.
+const size_t UploadRingSize = 16 * 1024 * 1024;
+
+// Staging memory for filling Default memory buffers and textures. A single
+// buffer or texture has to fit in it.
+const size_t UploadStagingSize = 32 * 1024 * 1024;
+
+struct BufferHandle
+{
+    uint32_t id = 0;
+    bool isValid() const { return id != 0; }
+};
+
+struct TextureHandle
+{
+    uint32_t id = 0;
+    bool isValid() const { return id != 0; }
+};
+
+struct PipelineHandle
+{
+    uint32_t id = 0;
+    bool isValid() const { return id != 0; }
+};
+
+struct BundleHandle
+{
+    uint32_t id = 0;
+    bool isValid() const { return id != 0; }
+};
+
+struct PresentParams
+{
+    // 0 presents right away, n waits for the n-th vertical blank.
+    uint32_t syncInterval = 1;
+    // Only with syncInterval 0, and only where isTearingSupported().
+    bool allowTearing = false;
+};
+
+// Per-frame memory from the upload ring. data is persistently mapped; the
+// GPU sees the same bytes at offset in buffer.
+struct UploadAllocation
+{
+    BufferHandle buffer;
+    size_t offset = 0;
+    void* data = nullptr;
+};
+
+// One entry of the argument buffer read by CommandRecorder::drawIndirect:
+// the draw's material and object, then the arguments of draw(). The layout is
+// the one the D3D12 command signature expects, so it is written straight into
+// upload memory.
+struct IndirectDrawCommand
+{
+    uint32_t material;
+    uint32_t object;
+    uint32_t vertexCount;
+    uint32_t instanceCount;
+    uint32_t firstVertex;
+    uint32_t firstInstance;
+};
+
+enum class MemoryType
+{
+    Default,    // GPU local, D3D12_HEAP_TYPE_DEFAULT, filled by the copy queue
+    Upload,     // CPU writable, persistently mapped
+    Readback
+};
+
+enum class BufferUsage
+{
+    Vertex,
+    Constant
+};
+
+struct BufferDesc
+{
+    size_t size = 0;
+    uint32_t stride = 0;
+    BufferUsage usage = BufferUsage::Vertex;
+    MemoryType memory = MemoryType::Upload;
+    const void* initialData = nullptr;
+};
+
+// RGBA8 texture, pixels are tightly packed rows.
+struct TextureDesc
+{
+    uint32_t width = 0;
+    uint32_t height = 0;
+    const uint8_t* pixels = nullptr;
+};
+
+enum class ShaderProgram
+{
+    Scene,          // VertexShader.hlsl + PixelShader.hlsl
+    SceneInstanced  // VertexShader.hlsl with INSTANCED + PixelShader.hlsl, reads InstanceData
+};
+
+struct PipelineDesc
+{
+    ShaderProgram program = ShaderProgram::Scene;
+    bool depthTest = true;
+    bool depthWrite = true;
+    bool cullBackFaces = true;
+    // Shader features, each one a separately compiled permutation. Unlit
+    // draws skip the light and the shadow lookup, untextured ones the texture
+    // fetch.
+    bool lit = true;
+    bool textured = true;
+    // Depth only, for the shadow passes: no pixel shader, a depth bias, and
+    // depth clamping instead of clipping, so casters between the light and
+    // the shadow map's near plane still cast.
+    bool shadowCaster = false;
+};
+
+// Bits of a shader permutation, the index of its compiled variant.
+enum ShaderFeature : uint32_t
+{
+    ShaderFeatureLit = 1 << 0,
+    ShaderFeatureTextured = 1 << 1,
+    ShaderFeatureInstanced = 1 << 2,
+    ShaderPermutationCount = 1 << 3
+};
+
+inline uint32_t getShaderPermutation(const PipelineDesc& desc)
+{
+    return (desc.lit ? static_cast<uint32_t>(ShaderFeatureLit) : 0u)
+        | (desc.textured ? static_cast<uint32_t>(ShaderFeatureTextured) : 0u)
+        | (desc.program == ShaderProgram::SceneInstanced ? static_cast<uint32_t>(ShaderFeatureInstanced) : 0u);
+}
+
+enum class ShadowLayer
+{
+    // Kept between frames, holds the casters that do not move.
+    Static,
+    // Rebuilt every frame from a copy of the static layer plus the moving
+    // casters; the one the scene samples.
+    Dynamic
+};
+
+class GpuProfiler;
+
+class CommandRecorder
+{
+public:
+    virtual ~CommandRecorder() = default;
+
+    virtual void setPipeline(PipelineHandle pipeline) = 0;
+    virtual void setConstantBuffer(BufferHandle buffer, size_t offset) = 0;
+    // Array of MaterialParams. Every texture is always bound, a draw only
+    // picks its entry with setMaterial, so switching materials costs one
+    // root constant.
+    virtual void setMaterialTable(BufferHandle buffer, size_t offset) = 0;
+    virtual void setMaterial(uint32_t material) = 0;
+    // Array of ObjectParams, the same way: the table is bound once and each
+    // draw selects its world matrix with setObject.
+    virtual void setObjectTable(BufferHandle buffer, size_t offset) = 0;
+    virtual void setObject(uint32_t object) = 0;
+    virtual void setVertexBuffer(BufferHandle buffer) = 0;
+    // instanceCount InstanceData entries at offset, the second vertex stream
+    // of SceneInstanced pipelines.
+    virtual void setInstanceBuffer(BufferHandle buffer, size_t offset, uint32_t instanceCount) = 0;
+    virtual void draw(uint32_t vertexCount, uint32_t instanceCount,
+        uint32_t firstVertex, uint32_t firstInstance) = 0;
+    // Runs drawCount IndirectDrawCommands from buffer as a single call; each
+    // one selects its material and object and draws with the current
+    // pipeline and vertex buffers. The material and object are undefined
+    // afterwards.
+    virtual void drawIndirect(BufferHandle buffer, size_t offset, uint32_t drawCount) = 0;
+    // Replays a prerecorded bundle. Bindings set on this recorder are visible
+    // inside it, the pipeline has to be set by the bundle itself.
+    virtual void executeBundle(BundleHandle bundle) = 0;
+};
+
+class RenderBackend
+{
+public:
+    virtual ~RenderBackend() = default;
+
+    virtual void init(uint32_t width, uint32_t height) = 0;
+    virtual void resize(uint32_t width, uint32_t height) = 0;
+    virtual void destroy() = 0;
+
+    virtual BufferHandle createBuffer(const BufferDesc& desc) = 0;
+    // The buffer and its memory are released once the frames in flight that
+    // may use it are done.
+    virtual void destroyBuffer(BufferHandle buffer) = 0;
+    // Upload buffers stay mapped for their whole lifetime.
+    virtual void* mapBuffer(BufferHandle buffer) = 0;
+    virtual TextureHandle createTexture(const TextureDesc& desc) = 0;
+    // Place of the texture in the bindless texture range.
+    virtual uint32_t getTextureIndex(TextureHandle texture) = 0;
+    // Returns right away, the same handle for the same description. The
+    // pipeline is compiled in the background, or loaded from the last run's
+    // pipeline library; until then draws use a compatible pipeline that is
+    // ready, and bundles wait for it.
+    virtual PipelineHandle createPipeline(const PipelineDesc& desc) = 0;
+
+    // Initial data of Default memory buffers and of textures is copied on a
+    // copy queue while frames keep going. The copies are batched and sent by
+    // flushUploads(), or by the next submitFrame() at the latest; draw with a
+    // resource only once it reports ready.
+    virtual bool isBufferReady(BufferHandle buffer) = 0;
+    virtual bool isTextureReady(TextureHandle texture) = 0;
+    virtual void flushUploads() = 0;
+
+    // Bundles are recorded once, outside a frame, and then reused by any
+    // recorder. Only one bundle can be open at a time.
+    virtual CommandRecorder& beginBundle() = 0;
+    virtual BundleHandle endBundle() = 0;
+
+    // Up to getFramesInFlight() frames can be queued on the GPU. Per-frame data
+    // written for the current slot is safe to overwrite: present() returns only
+    // once the GPU is done with the frame that used the next slot before.
+    virtual uint32_t getFramesInFlight() const = 0;
+    virtual uint32_t getFrameSlot() const = 0;
+
+    // Scratch memory for data that only the current frame reads: constants,
+    // dynamic vertices, instance data. It is recycled after the GPU is done
+    // with the frame, so nothing here needs its own resource. Blocks only if
+    // the ring is full of frames still in flight.
+    virtual UploadAllocation allocateUpload(size_t size, size_t alignment = ConstantBufferAlignment) = 0;
+
+    // Cascaded shadow maps for the directional light: a size x size depth
+    // layer per cascade in each ShadowLayer. Call once, after init().
+    virtual void createShadowMaps(uint32_t size, uint32_t cascadeCount) = 0;
+
+    // Shadow passes are recorded before beginFrame(), on the recorder it
+    // returns. Static passes come first: each clears its layer and binds it
+    // as the only target, static layers without a pass keep their contents.
+    // The first Dynamic pass, or beginFrame() if there is none, copies the
+    // static layers into the dynamic ones; frames after one without Static
+    // or Dynamic passes skip the copy.
+    virtual CommandRecorder& beginShadowPass(ShadowLayer layer, uint32_t cascade) = 0;
+
+    // Transitions and clears the back buffer and depth buffer, and binds them
+    // after any shadow passes.
+    virtual CommandRecorder& beginFrame(const float clearColor[4]) = 0;
+
+    // Extra recorders for filling the frame from several threads. Each one
+    // starts with the frame's targets bound but no pipeline or bindings, and
+    // may be used by one thread at a time. submitFrame() executes the
+    // beginFrame() recorder first, then the parallel ones in index order.
+    virtual uint32_t getMaxParallelRecorders() const = 0;
+    virtual CommandRecorder& beginParallelRecorder(uint32_t index) = 0;
+
+    virtual void submitFrame() = 0;
+    virtual void present() = 0;
+
+    virtual bool isTearingSupported() const = 0;
+    virtual void setPresentParams(const PresentParams& params) = 0;
+    // Blocks until the swap chain can take another frame without queueing it
+    // behind one that is not shown yet. Called before input is sampled, it
+    // keeps the input one frame away from the display.
+    virtual void waitForPresentSlot() = 0;
+
+    // GPU time of the frame's passes, read back a few frames late. nullptr
+    // for backends without a GPU timeline.
+    virtual const GpuProfiler* getGpuProfiler() const = 0;
+};
@@ -0,0 +1,274 @@
+#include "RenderGraph.h"
+
+#include <algorithm>
+#include <chrono>
+
+void RenderGraph::reset()
+{
+    resources.clear();
+    passes.clear();
+    finalBarriers.clear();
+    transientHeapSize = 0;
+    stats = {};
+}
+
+uint32_t RenderGraph::importResource(const std::string& name, ResourceState initialState, ResourceState finalState)
+{
+    resources.push_back({ name, false, initialState, finalState, 0, 0, InvalidOffset, UINT32_MAX, 0 });
+    return static_cast<uint32_t>(resources.size() - 1);
+}
+
+uint32_t RenderGraph::createTransient(const std::string& name, uint64_t size, uint64_t alignment)
+{
+    resources.push_back({ name, true, ResourceState::Common, ResourceState::Common, size, alignment,
+        InvalidOffset, UINT32_MAX, 0 });
+    return static_cast<uint32_t>(resources.size() - 1);
+}
+
+uint32_t RenderGraph::addPass(const std::string& name)
+{
+    passes.push_back({ name, {}, false, false, {} });
+    return static_cast<uint32_t>(passes.size() - 1);
+}
+
+void RenderGraph::read(uint32_t pass, uint32_t resource, ResourceState state)
+{
+    passes[pass].accesses.push_back({ resource, state, false });
+}
+
+void RenderGraph::write(uint32_t pass, uint32_t resource, ResourceState state)
+{
+    passes[pass].accesses.push_back({ resource, state, true });
+}
+
+void RenderGraph::setSideEffects(uint32_t pass)
+{
+    passes[pass].sideEffects = true;
+}
+
+void RenderGraph::compile()
+{
+    const auto start = std::chrono::steady_clock::now();
+
+    finalBarriers.clear();
+    for (Pass& pass : passes)
+        pass.barriers.clear();
+    for (Resource& resource : resources)
+    {
+        resource.offset = InvalidOffset;
+        resource.firstUse = UINT32_MAX;
+        resource.lastUse = 0;
+    }
+
+    stats = {};
+    cullPasses();
+    computeLifetimes();
+    placeTransients();
+    buildBarriers();
+
+    stats.passes = static_cast<uint32_t>(passes.size());
+    stats.transientHeapSize = transientHeapSize;
+    stats.compileMs = std::chrono::duration<double, std::milli>(
+        std::chrono::steady_clock::now() - start).count();
+}
+
+void RenderGraph::cullPasses()
+{
+    // Walking back from the end, a pass stays if it writes an imported
+    // resource or something a later pass still reads. Whatever it writes
+    // without reading is overwritten, so earlier writers are not needed for it.
+    std::vector<bool> needed(resources.size(), false);
+
+    for (uint32_t i = static_cast<uint32_t>(passes.size()); i-- > 0;)
+    {
+        Pass& pass = passes[i];
+
+        bool live = pass.sideEffects;
+        for (const Access& access : pass.accesses)
+        {
+            if (access.write && (!resources[access.resource].transient || needed[access.resource]))
+                live = true;
+        }
+
+        pass.culled = !live;
+        if (!live)
+        {
+            stats.culledPasses++;
+            continue;
+        }
+
+        for (const Access& access : pass.accesses)
+        {
+            if (access.write)
+                needed[access.resource] = false;
+        }
+        for (const Access& access : pass.accesses)
+        {
+            if (!access.write)
+                needed[access.resource] = true;
+        }
+    }
+}
+
+void RenderGraph::computeLifetimes()
+{
+    uint32_t position = 0;
+    for (const Pass& pass : passes)
+    {
+        if (pass.culled)
+            continue;
+
+        for (const Access& access : pass.accesses)
+        {
+            Resource& resource = resources[access.resource];
+            resource.firstUse = std::min(resource.firstUse, position);
+            resource.lastUse = std::max(resource.lastUse, position);
+        }
+        position++;
+    }
+}
+
+void RenderGraph::placeTransients()
+{
+    std::vector<uint32_t> order;
+    for (uint32_t i = 0; i < resources.size(); i++)
+    {
+        if (resources[i].transient && resources[i].firstUse != UINT32_MAX)
+            order.push_back(i);
+    }
+
+    // Largest first, each at the lowest offset that does not overlap a
+    // resource alive at the same time.
+    std::stable_sort(order.begin(), order.end(), [this](uint32_t a, uint32_t b) {
+        return resources[a].size > resources[b].size;
+    });
+
+    transientHeapSize = 0;
+    std::vector<const Resource*> overlapping;
+    for (size_t i = 0; i < order.size(); i++)
+    {
+        Resource& resource = resources[order[i]];
+
+        overlapping.clear();
+        for (size_t j = 0; j < i; j++)
+        {
+            const Resource& placed = resources[order[j]];
+            if (placed.firstUse <= resource.lastUse && resource.firstUse <= placed.lastUse)
+                overlapping.push_back(&placed);
+        }
+        std::sort(overlapping.begin(), overlapping.end(), [](const Resource* a, const Resource* b) {
+            return a->offset < b->offset;
+        });
+
+        const uint64_t mask = resource.alignment - 1;
+        uint64_t offset = 0;
+        for (const Resource* placed : overlapping)
+        {
+            if (offset + resource.size <= placed->offset)
+                break;
+            offset = std::max(offset, (placed->offset + placed->size + mask) & ~mask);
+        }
+
+        resource.offset = offset;
+        transientHeapSize = std::max(transientHeapSize, offset + resource.size);
+        stats.unaliasedSize += resource.size;
+        stats.transientResources++;
+    }
+}
+
+bool RenderGraph::isAliased(uint32_t index) const
+{
+    const Resource& resource = resources[index];
+    for (const Resource& other : resources)
+    {
+        if (other.transient && other.offset != InvalidOffset && other.lastUse < resource.firstUse
+            && other.offset < resource.offset + resource.size && resource.offset < other.offset + other.size)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+void RenderGraph::buildBarriers()
+{
+    std::vector<ResourceState> states(resources.size());
+    std::vector<bool> used(resources.size(), false);
+    for (uint32_t i = 0; i < resources.size(); i++)
+        states[i] = resources[i].initialState;
+
+    // State each resource needs in the pass: the written state if the pass
+    // writes it, otherwise all the read states together.
+    std::vector<ResourceState> passStates(resources.size());
+    std::vector<uint32_t> touched;
+
+    for (Pass& pass : passes)
+    {
+        if (pass.culled)
+            continue;
+
+        touched.clear();
+        for (const Access& access : pass.accesses)
+        {
+            if (std::find(touched.begin(), touched.end(), access.resource) == touched.end())
+            {
+                touched.push_back(access.resource);
+                passStates[access.resource] = ResourceState::Common;
+            }
+        }
+        for (const Access& access : pass.accesses)
+        {
+            if (access.write)
+                passStates[access.resource] = passStates[access.resource] | access.state;
+        }
+        for (const Access& access : pass.accesses)
+        {
+            if (!access.write)
+            {
+                bool written = false;
+                for (const Access& other : pass.accesses)
+                    written |= other.write && other.resource == access.resource;
+                if (!written)
+                    passStates[access.resource] = passStates[access.resource] | access.state;
+            }
+        }
+
+        for (uint32_t index : touched)
+        {
+            Resource& resource = resources[index];
+            const ResourceState state = passStates[index];
+
+            if (resource.transient && !used[index])
+            {
+                // Created in the state of its first use; it only needs an
+                // aliasing barrier if it takes over another one's memory.
+                resource.initialState = state;
+                states[index] = state;
+                if (isAliased(index))
+                {
+                    pass.barriers.push_back({ RenderGraphBarrier::Type::Aliasing, index, state, state });
+                    stats.aliasingBarriers++;
+                }
+            }
+            else if (states[index] != state)
+            {
+                pass.barriers.push_back({ RenderGraphBarrier::Type::Transition, index, states[index], state });
+                states[index] = state;
+            }
+            used[index] = true;
+        }
+
+        stats.barriers += static_cast<uint32_t>(pass.barriers.size());
+        if (!pass.barriers.empty())
+            stats.barrierBatches++;
+    }
+
+    for (uint32_t i = 0; i < resources.size(); i++)
+    {
+        if (!resources[i].transient && states[i] != resources[i].finalState)
+            finalBarriers.push_back({ RenderGraphBarrier::Type::Transition, i, states[i], resources[i].finalState });
+    }
+    stats.barriers += static_cast<uint32_t>(finalBarriers.size());
+    if (!finalBarriers.empty())
+        stats.barrierBatches++;
+}
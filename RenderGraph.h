@@ -0,0 +1,148 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Read states can be combined, e.g. a depth buffer that is tested against
+// and sampled in the same pass.
+enum class ResourceState : uint32_t
+{
+    Common = 0,
+    RenderTarget = 1 << 0,
+    DepthWrite = 1 << 1,
+    DepthRead = 1 << 2,
+    ShaderResource = 1 << 3,
+    CopySource = 1 << 4,
+    CopyDest = 1 << 5,
+    Present = 1 << 6
+};
+
+inline ResourceState operator|(ResourceState a, ResourceState b)
+{
+    return static_cast<ResourceState>(static_cast<uint32_t>(a) | static_cast<uint32_t>(b));
+}
+
+struct RenderGraphBarrier
+{
+    enum class Type
+    {
+        Transition,
+        // The resource takes over memory used by an earlier transient; the
+        // backend has to clear or discard it before use.
+        Aliasing
+    };
+
+    Type type;
+    uint32_t resource;
+    ResourceState before;
+    ResourceState after;
+};
+
+// Describes a frame as passes with the resources they read and write, without
+// touching an API. compile() drops passes whose results are never used, works
+// out the transitions each pass needs (issued as one batch before it) and
+// places transient resources with disjoint lifetimes in the same memory. The
+// backend walks the result when recording. Passes run in declaration order.
+class RenderGraph
+{
+public:
+    static constexpr uint64_t InvalidOffset = UINT64_MAX;
+
+    struct Stats
+    {
+        uint32_t passes;
+        uint32_t culledPasses;
+        uint32_t barriers;
+        uint32_t aliasingBarriers;
+        uint32_t barrierBatches;
+        uint32_t transientResources;
+        // Heap size with aliasing against the sum of all transient sizes.
+        uint64_t transientHeapSize;
+        uint64_t unaliasedSize;
+        double compileMs;
+    };
+
+    void reset();
+
+    // Imported resources live outside the graph (back buffer, depth buffer);
+    // they are expected in initialState and left in finalState.
+    uint32_t importResource(const std::string& name, ResourceState initialState, ResourceState finalState);
+    // Transient resources only exist between their first and last use. Size
+    // and alignment come from the device, e.g. GetResourceAllocationInfo.
+    uint32_t createTransient(const std::string& name, uint64_t size, uint64_t alignment);
+
+    uint32_t addPass(const std::string& name);
+    void read(uint32_t pass, uint32_t resource, ResourceState state);
+    void write(uint32_t pass, uint32_t resource, ResourceState state);
+    // Keeps the pass even though it writes nothing that is used later, e.g.
+    // a readback.
+    void setSideEffects(uint32_t pass);
+
+    void compile();
+
+    uint32_t getPassCount() const { return static_cast<uint32_t>(passes.size()); }
+    const std::string& getPassName(uint32_t pass) const { return passes[pass].name; }
+    bool isPassCulled(uint32_t pass) const { return passes[pass].culled; }
+    // Barriers to issue right before the pass.
+    const std::vector<RenderGraphBarrier>& getBarriers(uint32_t pass) const { return passes[pass].barriers; }
+    // Barriers bringing imported resources to their final state after the
+    // last pass.
+    const std::vector<RenderGraphBarrier>& getFinalBarriers() const { return finalBarriers; }
+
+    uint32_t getResourceCount() const { return static_cast<uint32_t>(resources.size()); }
+    bool isTransient(uint32_t resource) const { return resources[resource].transient; }
+    // InvalidOffset for transients no remaining pass uses.
+    uint64_t getTransientOffset(uint32_t resource) const { return resources[resource].offset; }
+    uint64_t getTransientSize(uint32_t resource) const { return resources[resource].size; }
+    // State the transient has to be created in (its first use).
+    ResourceState getTransientInitialState(uint32_t resource) const { return resources[resource].initialState; }
+    uint64_t getTransientHeapSize() const { return transientHeapSize; }
+
+    const Stats& getStats() const { return stats; }
+
+private:
+    struct Resource
+    {
+        std::string name;
+        bool transient;
+        ResourceState initialState;
+        ResourceState finalState;
+        uint64_t size;
+        uint64_t alignment;
+
+        uint64_t offset;
+        // Positions among the passes that survived culling.
+        uint32_t firstUse;
+        uint32_t lastUse;
+    };
+
+    struct Access
+    {
+        uint32_t resource;
+        ResourceState state;
+        bool write;
+    };
+
+    struct Pass
+    {
+        std::string name;
+        std::vector<Access> accesses;
+        bool sideEffects;
+        bool culled;
+        std::vector<RenderGraphBarrier> barriers;
+    };
+
+    std::vector<Resource> resources;
+    std::vector<Pass> passes;
+    std::vector<RenderGraphBarrier> finalBarriers;
+    uint64_t transientHeapSize = 0;
+    Stats stats = {};
+
+    void cullPasses();
+    void computeLifetimes();
+    void placeTransients();
+    void buildBarriers();
+    // Whether an earlier transient shares memory with the resource.
+    bool isAliased(uint32_t resource) const;
+};
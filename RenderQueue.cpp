@@ -0,0 +1,86 @@
+#include "RenderQueue.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace
+{
+    const uint32_t MeshShift = 0;
+    const uint32_t DepthShift = MeshShift + RenderQueue::MeshBits;
+    const uint32_t MaterialShift = DepthShift + RenderQueue::DepthBits;
+    const uint32_t PipelineShift = MaterialShift + RenderQueue::MaterialBits;
+    const uint32_t PassShift = PipelineShift + RenderQueue::PipelineBits;
+
+    static_assert(PassShift + RenderQueue::PassBits == 64, "sort key fields have to fill 64 bits");
+
+    uint64_t field(uint32_t value, uint32_t bits, uint32_t shift)
+    {
+        return (static_cast<uint64_t>(value) & ((1ull << bits) - 1)) << shift;
+    }
+}
+
+uint64_t RenderQueue::makeKey(uint32_t pass, uint32_t pipeline, uint32_t material, float depth, uint32_t mesh)
+{
+    const float maxDepth = static_cast<float>((1u << DepthBits) - 1);
+    const uint32_t quantizedDepth = static_cast<uint32_t>(std::min(std::max(depth, 0.0f), 1.0f) * maxDepth);
+
+    return field(pass, PassBits, PassShift) |
+        field(pipeline, PipelineBits, PipelineShift) |
+        field(material, MaterialBits, MaterialShift) |
+        field(quantizedDepth, DepthBits, DepthShift) |
+        field(mesh, MeshBits, MeshShift);
+}
+
+uint32_t RenderQueue::getPipeline(uint64_t key)
+{
+    return static_cast<uint32_t>((key >> PipelineShift) & ((1ull << PipelineBits) - 1));
+}
+
+uint32_t RenderQueue::getMaterial(uint64_t key)
+{
+    return static_cast<uint32_t>((key >> MaterialShift) & ((1ull << MaterialBits) - 1));
+}
+
+void RenderQueue::sort()
+{
+    const size_t count = packets.size();
+    if (count < 2)
+        return;
+
+    // All eight histograms in one read of the keys.
+    uint32_t histograms[8][256];
+    memset(histograms, 0, sizeof(histograms));
+    for (const DrawPacket& packet : packets)
+    {
+        for (uint32_t digit = 0; digit < 8; digit++)
+            histograms[digit][(packet.key >> (8 * digit)) & 0xff]++;
+    }
+
+    scratch.resize(count);
+    DrawPacket* source = packets.data();
+    DrawPacket* target = scratch.data();
+
+    for (uint32_t digit = 0; digit < 8; digit++)
+    {
+        uint32_t* histogram = histograms[digit];
+        const uint32_t shift = 8 * digit;
+        if (histogram[(source[0].key >> shift) & 0xff] == count)
+            continue;
+
+        uint32_t offset = 0;
+        for (uint32_t bucket = 0; bucket < 256; bucket++)
+        {
+            const uint32_t bucketCount = histogram[bucket];
+            histogram[bucket] = offset;
+            offset += bucketCount;
+        }
+
+        for (size_t i = 0; i < count; i++)
+            target[histogram[(source[i].key >> shift) & 0xff]++] = source[i];
+
+        std::swap(source, target);
+    }
+
+    if (source != packets.data())
+        packets.swap(scratch);
+}
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// One draw waiting to be recorded. item is whatever the producer needs to
+// record it, e.g. a scene object index.
+struct DrawPacket
+{
+    uint64_t key;
+    uint32_t item;
+};
+
+// Draw packets of one frame, recorded in the order of their 64-bit sort
+// keys. From the most significant bits down a key holds the pass, pipeline,
+// material, depth and mesh, so packets sharing state end up next to each
+// other and, within the same state, are drawn front to back.
+class RenderQueue
+{
+public:
+    static constexpr uint32_t PassBits = 4;
+    static constexpr uint32_t PipelineBits = 8;
+    static constexpr uint32_t MaterialBits = 16;
+    static constexpr uint32_t DepthBits = 24;
+    static constexpr uint32_t MeshBits = 12;
+
+    // Fields are truncated to their widths. depth is normalized to [0, 1];
+    // pass 1 - depth for back to front.
+    static uint64_t makeKey(uint32_t pass, uint32_t pipeline, uint32_t material, float depth, uint32_t mesh);
+    static uint32_t getPipeline(uint64_t key);
+    static uint32_t getMaterial(uint64_t key);
+
+    void clear() { packets.clear(); }
+    void push(uint64_t key, uint32_t item) { packets.push_back({ key, item }); }
+
+    // LSD radix sort, 8 bits per pass. Passes where every key has the same
+    // digit are skipped, which with few passes and pipelines is most of the
+    // high ones. Stable, so equal keys keep their push order.
+    void sort();
+
+    const std::vector<DrawPacket>& getPackets() const { return packets; }
+    size_t size() const { return packets.size(); }
+
+private:
+    std::vector<DrawPacket> packets;
+    std::vector<DrawPacket> scratch;
+};
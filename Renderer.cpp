@@ -0,0 +1,605 @@
+#include "Renderer.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+
+#include "CpuProfiler.h"
+
+namespace
+{
+    double getElapsedMs(std::chrono::steady_clock::time_point start)
+    {
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    const uint32_t OpaquePass = 0;
+
+    // Direction of the sunlight, in world space.
+    const XMFLOAT3 SunDirection = { 0.3f, -1.0f, 0.6f };
+    const float ShadowBias = 0.001f;
+    const float ShadowStrength = 0.7f;
+
+    uint32_t packTint(const XMFLOAT4& tint)
+    {
+        auto channel = [](float value) {
+            return static_cast<uint32_t>(std::min(std::max(value, 0.0f), 1.0f) * 255.0f + 0.5f);
+        };
+        return channel(tint.x) | (channel(tint.y) << 8) | (channel(tint.z) << 16) | (channel(tint.w) << 24);
+    }
+}
+
+Renderer::Renderer(RenderBackend& backend, const RendererSettings& settings) :
+    backend(backend),
+    settings(settings)
+{
+    if (settings.recordingThreads > 1)
+        workers = std::make_unique<WorkerPool>(settings.recordingThreads);
+}
+
+void Renderer::init(uint32_t width, uint32_t height, const TextureDesc& textureDesc)
+{
+    this->width = width;
+    this->height = height;
+
+    backend.init(width, height);
+    scene.init();
+
+    for (uint32_t i = 0; i < ShaderPermutationCount; i++)
+    {
+        PipelineDesc desc;
+        desc.program = (i & ShaderFeatureInstanced) ? ShaderProgram::SceneInstanced : ShaderProgram::Scene;
+        desc.lit = (i & ShaderFeatureLit) != 0;
+        desc.textured = (i & ShaderFeatureTextured) != 0;
+        pipelines[i] = backend.createPipeline(desc);
+    }
+
+    PipelineDesc shadowDesc;
+    shadowDesc.shadowCaster = true;
+    shadowDesc.lit = false;
+    shadowDesc.textured = false;
+    shadowPipeline = backend.createPipeline(shadowDesc);
+    shadowDesc.program = ShaderProgram::SceneInstanced;
+    shadowInstancedPipeline = backend.createPipeline(shadowDesc);
+
+    shadows.init(settings.shadows);
+    backend.createShadowMaps(shadows.getSettings().resolution, shadows.getCascadeCount());
+
+    std::vector<Vertex> vertices;
+    for (const Mesh& mesh : scene.getMeshes())
+    {
+        meshFirstVertex.push_back(static_cast<uint32_t>(vertices.size()));
+        vertices.insert(vertices.end(), mesh.vertices, mesh.vertices + mesh.vertexCount);
+    }
+
+    BufferDesc desc;
+    desc.size = vertices.size() * sizeof(Vertex);
+    desc.stride = sizeof(Vertex);
+    desc.usage = BufferUsage::Vertex;
+    desc.memory = MemoryType::Default;
+    desc.initialData = vertices.data();
+    geometryBuffer = backend.createBuffer(desc);
+
+    textures.push_back(backend.createTexture(textureDesc));
+    backend.flushUploads();
+
+    // A bundle sets its own pipeline, so each mesh gets one per
+    // non-instanced permutation. They bind the geometry buffer's address,
+    // so the backend must not move it (defragmentMemory()) while they live.
+    if (settings.useBundles)
+    {
+        for (uint32_t permutation = 0; permutation < ShaderFeatureInstanced; permutation++)
+        {
+            for (size_t i = 0; i < scene.getMeshes().size(); i++)
+            {
+                CommandRecorder& bundle = backend.beginBundle();
+                bundle.setPipeline(pipelines[permutation]);
+                bundle.setVertexBuffer(geometryBuffer);
+                bundle.draw(scene.getMeshes()[i].vertexCount, 1, meshFirstVertex[i], 0);
+                meshBundles.push_back(backend.endBundle());
+            }
+        }
+    }
+}
+
+uint32_t Renderer::getPermutation(const Material& material, bool instanced)
+{
+    PipelineDesc desc;
+    desc.program = instanced ? ShaderProgram::SceneInstanced : ShaderProgram::Scene;
+    desc.lit = material.lit;
+    desc.textured = material.textured;
+    return getShaderPermutation(desc);
+}
+
+bool Renderer::isInstancedPipeline(uint32_t pipeline) const
+{
+    for (uint32_t i = ShaderFeatureInstanced; i < ShaderPermutationCount; i++)
+    {
+        if (pipelines[i].id == pipeline)
+            return true;
+    }
+    return false;
+}
+
+void Renderer::update(float interpolation)
+{
+    PROFILE_ZONE("UpdateScene");
+
+    vs_const_buffer_t vsConstBuffer = {};
+    vsConstBuffer.colLight = { 1.f, 1.f, 1.f, 1.f };
+
+    XMMATRIX vp_matrix = scene.getCameraMatrix(interpolation);
+    XMStoreFloat4x4(&viewMatrix, vp_matrix);
+
+    const XMVECTOR sun = XMVector3Normalize(XMLoadFloat3(&SunDirection));
+    XMStoreFloat4(&vsConstBuffer.dirLight, XMVector3Normalize(XMVector3TransformNormal(sun, vp_matrix)));
+
+    const float aspect = static_cast<float>(width) / static_cast<float>(height);
+    shadows.update(vp_matrix, FieldOfView, aspect, NearPlane, sun, scene.getStaticVersion());
+    float* splits = &vsConstBuffer.cascadeSplits.x;
+    for (uint32_t i = 0; i < shadows.getCascadeCount(); i++)
+    {
+        XMStoreFloat4x4(&vsConstBuffer.matShadow[i], XMMatrixTranspose(XMLoadFloat4x4(&shadows.getCascade(i).viewProj)));
+        splits[i] = shadows.getCascade(i).splitDepth;
+    }
+    vsConstBuffer.shadowParams = { static_cast<float>(shadows.getCascadeCount()), ShadowBias, ShadowStrength, 0.0f };
+
+    XMStoreFloat4x4(
+        &vsConstBuffer.matView,
+        XMMatrixTranspose(vp_matrix)
+    );
+
+    // Projection space
+    vp_matrix = XMMatrixMultiply(
+        vp_matrix,
+        XMMatrixPerspectiveFovLH(
+            FieldOfView, aspect, NearPlane, FarPlane
+        )
+    );
+
+    XMStoreFloat4x4(
+        &vsConstBuffer.matViewProj,
+        XMMatrixTranspose(vp_matrix)
+    );
+    frustum = extractFrustum(vp_matrix);
+
+    // Fresh ring memory every frame, so frames still on the GPU keep theirs.
+    frameConstants = backend.allocateUpload(sizeof(vsConstBuffer));
+    memcpy(
+        frameConstants.data,
+        &vsConstBuffer,
+        sizeof(vsConstBuffer)
+    );
+
+    for (uint32_t i = 0; i < shadows.getCascadeCount(); i++)
+    {
+        vsConstBuffer.matViewProj = vsConstBuffer.matShadow[i];
+        shadowConstants[i] = backend.allocateUpload(sizeof(vsConstBuffer));
+        memcpy(shadowConstants[i].data, &vsConstBuffer, sizeof(vsConstBuffer));
+    }
+
+    // The table is small enough to rewrite every frame, which spares keeping
+    // track of which frames still read an older copy.
+    const std::vector<Material>& materials = scene.getMaterials();
+    materialTable = backend.allocateUpload(materials.size() * sizeof(MaterialParams));
+    MaterialParams* params = static_cast<MaterialParams*>(materialTable.data);
+    for (size_t i = 0; i < materials.size(); i++)
+    {
+        params[i].color = materials[i].color;
+        params[i].textureIndex = backend.getTextureIndex(textures[materials[i].texture]);
+    }
+
+    // Objects may move every frame, so their matrices are rewritten the same
+    // way; each draw then only picks its entry.
+    const std::vector<SceneObject>& objects = scene.getObjects();
+    objectTable = backend.allocateUpload(objects.size() * sizeof(ObjectParams));
+    ObjectParams* objectParams = static_cast<ObjectParams*>(objectTable.data);
+    for (size_t i = 0; i < objects.size(); i++)
+        XMStoreFloat4x4(&objectParams[i].matWorld, XMMatrixTranspose(XMLoadFloat4x4(&objects[i].world)));
+
+    updateInstances();
+}
+
+void Renderer::updateInstances()
+{
+    PROFILE_ZONE("UpdateInstances");
+    const auto start = std::chrono::steady_clock::now();
+
+    const std::vector<InstanceGroup>& groups = scene.getInstanceGroups();
+    instanceOffsets.resize(groups.size());
+    visibleInstanceCounts.assign(groups.size(), 0);
+    stats.visibleInstances = 0;
+    stats.instanceCullMs = 0.0;
+    uint32_t instanceCount = 0;
+    for (size_t i = 0; i < groups.size(); i++)
+    {
+        instanceOffsets[i] = instanceCount;
+        instanceCount += static_cast<uint32_t>(groups[i].instances.size());
+    }
+
+    instanceData = UploadAllocation();
+    if (instanceCount > 0)
+    {
+        instanceData = backend.allocateUpload(instanceCount * sizeof(InstanceData));
+        InstanceData* data = static_cast<InstanceData*>(instanceData.data);
+        for (size_t i = 0; i < groups.size(); i++)
+        {
+            const InstanceGroup& group = groups[i];
+            findVisible(group.bounds, stats.instanceCullMs);
+            visibleInstanceCounts[i] = static_cast<uint32_t>(visibleIndices.size());
+            stats.visibleInstances += visibleInstanceCounts[i];
+
+            // visibleIndices is in increasing order, so one pass splits the
+            // group into the visible front and the rest.
+            InstanceData* front = data + instanceOffsets[i];
+            InstanceData* back = front + visibleIndices.size();
+            size_t nextVisible = 0;
+            for (size_t j = 0; j < group.instances.size(); j++)
+            {
+                InstanceData* out;
+                if (nextVisible < visibleIndices.size() && visibleIndices[nextVisible] == j)
+                {
+                    out = front++;
+                    nextVisible++;
+                }
+                else
+                {
+                    out = back++;
+                }
+
+                // Columns of the world matrix, so the shader can skip the
+                // constant last one.
+                const Instance& instance = group.instances[j];
+                const XMFLOAT4X4& world = instance.world;
+                for (int column = 0; column < 3; column++)
+                    out->world[column] = { world.m[0][column], world.m[1][column], world.m[2][column], world.m[3][column] };
+                out->tint = packTint(instance.tint);
+                out->lit = instance.lit ? 1 : 0;
+            }
+        }
+    }
+
+    stats.instances = instanceCount;
+    stats.instanceUpdateMs = getElapsedMs(start);
+}
+
+void Renderer::render()
+{
+    PROFILE_ZONE("Render");
+    const auto start = std::chrono::steady_clock::now();
+
+    if (!allResourcesReady || materialReady.size() != scene.getMaterials().size())
+        updateResourceReadiness();
+
+    recordShadows();
+
+    const float clearColor[] = { 0.61f, 0.80f, 0.83f, 1.0f };
+    CommandRecorder& commands = backend.beginFrame(clearColor);
+
+    buildQueue();
+
+    const size_t packetCount = queue.size();
+    const uint32_t recorderCount = getRecorderCount(packetCount);
+
+    if (settings.useIndirectDraws)
+    {
+        recordIndirectDraws(commands);
+    }
+    else if (recorderCount <= 1)
+    {
+        recordPackets(commands, 0, packetCount);
+    }
+    else
+    {
+        // Contiguous ranges keep the submitted draw order the same as the
+        // single-threaded path.
+        workers->run(recorderCount, [&](uint32_t index) {
+            recordPackets(backend.beginParallelRecorder(index),
+                packetCount * index / recorderCount,
+                packetCount * (index + 1) / recorderCount);
+        });
+    }
+
+    stats.recordMs = getElapsedMs(start);
+
+    backend.submitFrame();
+    backend.present();
+}
+
+void Renderer::resize(uint32_t width, uint32_t height)
+{
+    this->width = width;
+    this->height = height;
+
+    backend.resize(width, height);
+}
+
+void Renderer::updateResourceReadiness()
+{
+    allResourcesReady = true;
+    materialReady.resize(scene.getMaterials().size());
+    for (size_t i = 0; i < materialReady.size(); i++)
+    {
+        materialReady[i] = backend.isTextureReady(textures[scene.getMaterials()[i].texture]);
+        allResourcesReady = allResourcesReady && materialReady[i];
+    }
+    geometryReady = backend.isBufferReady(geometryBuffer);
+    allResourcesReady = allResourcesReady && geometryReady;
+}
+
+void Renderer::recordShadows()
+{
+    PROFILE_ZONE("RecordShadows");
+    stats.shadowDraws = 0;
+    stats.staticShadowCascades = 0;
+
+    // Static layers drawn now would keep missing the geometry.
+    if (!geometryReady)
+    {
+        shadows.invalidate();
+        return;
+    }
+
+    for (uint32_t cascade = 0; cascade < shadows.getCascadeCount(); cascade++)
+    {
+        if (!shadows.getCascade(cascade).staticDirty)
+            continue;
+
+        recordShadowCasters(backend.beginShadowPass(ShadowLayer::Static, cascade), cascade, false);
+        stats.staticShadowCascades++;
+    }
+
+    const std::vector<SceneObject>& objects = scene.getObjects();
+    if (std::none_of(objects.begin(), objects.end(), [](const SceneObject& object) { return object.dynamic; }))
+        return;
+
+    for (uint32_t cascade = 0; cascade < shadows.getCascadeCount(); cascade++)
+        recordShadowCasters(backend.beginShadowPass(ShadowLayer::Dynamic, cascade), cascade, true);
+}
+
+void Renderer::recordShadowCasters(CommandRecorder& commands, uint32_t cascade, bool dynamic)
+{
+    commands.setConstantBuffer(shadowConstants[cascade].buffer, shadowConstants[cascade].offset);
+    // The vertex shader still reads the material's color.
+    commands.setMaterialTable(materialTable.buffer, materialTable.offset);
+    commands.setObjectTable(objectTable.buffer, objectTable.offset);
+    commands.setVertexBuffer(geometryBuffer);
+    commands.setPipeline(shadowPipeline);
+
+    const std::vector<Mesh>& meshes = scene.getMeshes();
+    const std::vector<SceneObject>& objects = scene.getObjects();
+    for (size_t i = 0; i < objects.size(); i++)
+    {
+        const SceneObject& object = objects[i];
+        if (object.dynamic != dynamic)
+            continue;
+
+        commands.setMaterial(object.material);
+        commands.setObject(static_cast<uint32_t>(i));
+        commands.draw(meshes[object.mesh].vertexCount, 1, meshFirstVertex[object.mesh], 0);
+        stats.shadowDraws++;
+    }
+
+    // Instances never move on their own, so they count as static.
+    if (dynamic || !instanceData.data)
+        return;
+
+    commands.setPipeline(shadowInstancedPipeline);
+    commands.setInstanceBuffer(instanceData.buffer, instanceData.offset, stats.instances);
+    const std::vector<InstanceGroup>& groups = scene.getInstanceGroups();
+    for (size_t i = 0; i < groups.size(); i++)
+    {
+        const InstanceGroup& group = groups[i];
+        if (group.instances.empty())
+            continue;
+
+        commands.setMaterial(group.material);
+        commands.draw(meshes[group.mesh].vertexCount, static_cast<uint32_t>(group.instances.size()),
+            meshFirstVertex[group.mesh], instanceOffsets[i]);
+        stats.shadowDraws++;
+    }
+}
+
+void Renderer::findVisible(const CullingBounds& bounds, double& cullMs)
+{
+    const auto start = std::chrono::steady_clock::now();
+
+    visibleIndices.clear();
+    if (settings.frustumCulling)
+    {
+        cullBounds(bounds, frustum, visibleIndices);
+    }
+    else
+    {
+        visibleIndices.resize(bounds.size());
+        for (size_t i = 0; i < bounds.size(); i++)
+            visibleIndices[i] = static_cast<uint32_t>(i);
+    }
+
+    cullMs += getElapsedMs(start);
+}
+
+uint32_t Renderer::getRecorderCount(size_t packetCount) const
+{
+    if (!workers)
+        return 1;
+
+    const size_t useful = std::max<size_t>(packetCount / MinPacketsPerRecorder, 1);
+    return static_cast<uint32_t>(std::min<size_t>(
+        { useful, workers->getThreadCount(), backend.getMaxParallelRecorders() }));
+}
+
+void Renderer::buildQueue()
+{
+    PROFILE_ZONE("BuildQueue");
+    queue.clear();
+    stats.objectCullMs = 0.0;
+    if (!geometryReady)
+        return;
+
+    const std::vector<Mesh>& meshes = scene.getMeshes();
+    const XMMATRIX view = XMLoadFloat4x4(&viewMatrix);
+
+    findVisible(scene.getObjectBounds(), stats.objectCullMs);
+    stats.visibleObjects = static_cast<uint32_t>(visibleIndices.size());
+
+    const std::vector<SceneObject>& objects = scene.getObjects();
+    for (uint32_t i : visibleIndices)
+    {
+        const SceneObject& object = objects[i];
+        if (!materialReady[object.material])
+            continue;
+
+        const Mesh& mesh = meshes[object.mesh];
+        const XMVECTOR center = XMVector3Transform(
+            XMVector3Transform(XMLoadFloat3(&mesh.center), XMLoadFloat4x4(&object.world)), view);
+        const float depth = (XMVectorGetZ(center) - NearPlane) / (FarPlane - NearPlane);
+
+        const PipelineHandle pipeline = pipelines[getPermutation(scene.getMaterials()[object.material], false)];
+        queue.push(RenderQueue::makeKey(OpaquePass, pipeline.id, object.material, depth, object.mesh), i);
+    }
+
+    // A group spreads over the whole scene, it has no depth of its own.
+    const std::vector<InstanceGroup>& groups = scene.getInstanceGroups();
+    stats.instancedDraws = 0;
+    for (size_t i = 0; i < groups.size(); i++)
+    {
+        const InstanceGroup& group = groups[i];
+        if (visibleInstanceCounts[i] == 0 || !materialReady[group.material])
+            continue;
+
+        stats.instancedDraws++;
+        const PipelineHandle pipeline = pipelines[getPermutation(scene.getMaterials()[group.material], true)];
+        queue.push(RenderQueue::makeKey(OpaquePass, pipeline.id, group.material, 0.0f, group.mesh),
+            static_cast<uint32_t>(i));
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    queue.sort();
+    stats.sortMs = getElapsedMs(start);
+    stats.packets = static_cast<uint32_t>(queue.size());
+}
+
+void Renderer::recordPackets(CommandRecorder& commands, size_t first, size_t last)
+{
+    PROFILE_ZONE("RecordPackets");
+    commands.setConstantBuffer(frameConstants.buffer, frameConstants.offset);
+    commands.setMaterialTable(materialTable.buffer, materialTable.offset);
+    commands.setObjectTable(objectTable.buffer, objectTable.offset);
+    if (first == last)
+        return;
+
+    commands.setVertexBuffer(geometryBuffer);
+    if (instanceData.data)
+        commands.setInstanceBuffer(instanceData.buffer, instanceData.offset, stats.instances);
+
+    const std::vector<DrawPacket>& packets = queue.getPackets();
+    const std::vector<Mesh>& meshes = scene.getMeshes();
+    uint32_t currentPipeline = 0;
+    uint32_t currentMaterial = UINT32_MAX;
+
+    // Packets come sorted by state, so only the changes are recorded.
+    for (size_t i = first; i < last; i++)
+    {
+        const DrawPacket& packet = packets[i];
+
+        const uint32_t packetPipeline = RenderQueue::getPipeline(packet.key);
+        if (packetPipeline != currentPipeline)
+        {
+            currentPipeline = packetPipeline;
+            commands.setPipeline({ packetPipeline });
+        }
+
+        const uint32_t packetMaterial = RenderQueue::getMaterial(packet.key);
+        if (packetMaterial != currentMaterial)
+        {
+            currentMaterial = packetMaterial;
+            commands.setMaterial(packetMaterial);
+        }
+
+        if (isInstancedPipeline(packetPipeline))
+        {
+            const InstanceGroup& group = scene.getInstanceGroups()[packet.item];
+            commands.draw(meshes[group.mesh].vertexCount, visibleInstanceCounts[packet.item],
+                meshFirstVertex[group.mesh], instanceOffsets[packet.item]);
+            continue;
+        }
+
+        const uint32_t mesh = scene.getObjects()[packet.item].mesh;
+        commands.setObject(packet.item);
+
+        if (!meshBundles.empty())
+        {
+            // The bundle sets the same pipeline as the packet.
+            const uint32_t permutation = getPermutation(scene.getMaterials()[packetMaterial], false);
+            commands.executeBundle(meshBundles[permutation * meshes.size() + mesh]);
+            continue;
+        }
+
+        commands.draw(meshes[mesh].vertexCount, 1, meshFirstVertex[mesh], 0);
+    }
+}
+
+void Renderer::recordIndirectDraws(CommandRecorder& commands)
+{
+    commands.setConstantBuffer(frameConstants.buffer, frameConstants.offset);
+    commands.setMaterialTable(materialTable.buffer, materialTable.offset);
+    commands.setObjectTable(objectTable.buffer, objectTable.offset);
+
+    const std::vector<DrawPacket>& packets = queue.getPackets();
+    if (packets.empty())
+        return;
+
+    const auto start = std::chrono::steady_clock::now();
+
+    const UploadAllocation arguments = backend.allocateUpload(packets.size() * sizeof(IndirectDrawCommand));
+    buildIndirectDraws(static_cast<IndirectDrawCommand*>(arguments.data));
+
+    stats.indirectBuildMs = getElapsedMs(start);
+
+    commands.setVertexBuffer(geometryBuffer);
+    if (instanceData.data)
+        commands.setInstanceBuffer(instanceData.buffer, instanceData.offset, stats.instances);
+
+    // One call per pipeline; the material changes go into the arguments.
+    for (size_t first = 0; first < packets.size(); )
+    {
+        const uint32_t packetPipeline = RenderQueue::getPipeline(packets[first].key);
+        size_t last = first + 1;
+        while (last < packets.size() && RenderQueue::getPipeline(packets[last].key) == packetPipeline)
+            last++;
+
+        commands.setPipeline({ packetPipeline });
+        commands.drawIndirect(arguments.buffer, arguments.offset + first * sizeof(IndirectDrawCommand),
+            static_cast<uint32_t>(last - first));
+        first = last;
+    }
+}
+
+void Renderer::buildIndirectDraws(IndirectDrawCommand* draws) const
+{
+    const std::vector<Mesh>& meshes = scene.getMeshes();
+    const std::vector<SceneObject>& objects = scene.getObjects();
+    const std::vector<InstanceGroup>& groups = scene.getInstanceGroups();
+
+    for (const DrawPacket& packet : queue.getPackets())
+    {
+        const uint32_t material = RenderQueue::getMaterial(packet.key);
+        if (isInstancedPipeline(RenderQueue::getPipeline(packet.key)))
+        {
+            const InstanceGroup& group = groups[packet.item];
+            *draws++ = { material, 0, meshes[group.mesh].vertexCount,
+                visibleInstanceCounts[packet.item], meshFirstVertex[group.mesh], instanceOffsets[packet.item] };
+        }
+        else
+        {
+            const uint32_t mesh = objects[packet.item].mesh;
+            *draws++ = { material, packet.item, meshes[mesh].vertexCount, 1, meshFirstVertex[mesh], 0 };
+        }
+    }
+}
+
+void Renderer::destroy()
+{
+    backend.destroy();
+}
@@ -0,0 +1,148 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "RenderBackend.h"
+#include "RenderQueue.h"
+#include "Scene.h"
+#include "ShadowCascades.h"
+#include "WorkerPool.h"
+
+struct RendererSettings
+{
+    // Threads recording draws, including the render thread.
+    uint32_t recordingThreads = 1;
+    // Draw each mesh through a bundle recorded at init.
+    bool useBundles = false;
+    // Write the frame's draws into an argument buffer and submit them with
+    // drawIndirect, one call per pipeline; recordingThreads and useBundles
+    // are not used then.
+    bool useIndirectDraws = false;
+    // Skip objects and instances outside the camera's frustum.
+    bool frustumCulling = true;
+    ShadowSettings shadows;
+};
+
+// CPU cost of the last frame, shown by the instancing stress test.
+struct RendererStats
+{
+    uint32_t instances = 0;
+    uint32_t instancedDraws = 0;
+    // Filling the instance stream in update().
+    double instanceUpdateMs = 0.0;
+    // What frustum culling left of the objects and instances. Culling the
+    // instances is part of instanceUpdateMs, culling the objects part of
+    // recordMs.
+    uint32_t visibleObjects = 0;
+    uint32_t visibleInstances = 0;
+    double instanceCullMs = 0.0;
+    double objectCullMs = 0.0;
+    // render() up to submitFrame(), recording included.
+    double recordMs = 0.0;
+    // Filling the argument buffer, with useIndirectDraws.
+    double indirectBuildMs = 0.0;
+    // Draw packets in the render queue and the time it took to sort them.
+    uint32_t packets = 0;
+    double sortMs = 0.0;
+    // Draws in the shadow passes, and the static layers among them that had
+    // to be drawn again.
+    uint32_t shadowDraws = 0;
+    uint32_t staticShadowCascades = 0;
+};
+
+// Scene and frame logic. Everything here goes through RenderBackend, so the
+// same code drives D3D12 on Windows and the null/software backends elsewhere.
+class Renderer
+{
+public:
+    explicit Renderer(RenderBackend& backend, const RendererSettings& settings = RendererSettings());
+
+    void init(uint32_t width, uint32_t height, const TextureDesc& textureDesc);
+    // interpolation goes to Scene::getCameraMatrix(); the simulation steps
+    // themselves run on the scene.
+    void update(float interpolation = 1.0f);
+    void render();
+    void resize(uint32_t width, uint32_t height);
+    void destroy();
+
+    Scene& getScene() { return scene; }
+    const Scene& getScene() const { return scene; }
+    const RendererStats& getStats() const { return stats; }
+    const ShadowCascades& getShadows() const { return shadows; }
+
+private:
+    // Below this many packets per list the extra command lists cost more
+    // than recording them on one thread.
+    static const uint32_t MinPacketsPerRecorder = 64;
+
+    static constexpr float FieldOfView = 3.14159f / 4.f;
+    static constexpr float NearPlane = 0.1f;
+    static constexpr float FarPlane = 100.0f;
+
+    RenderBackend& backend;
+    RendererSettings settings;
+    Scene scene;
+    std::unique_ptr<WorkerPool> workers;
+
+    uint32_t width = 0;
+    uint32_t height = 0;
+    XMFLOAT4X4 viewMatrix;
+
+    // One per shader permutation, indexed by getShaderPermutation().
+    PipelineHandle pipelines[ShaderPermutationCount];
+    PipelineHandle shadowPipeline;
+    PipelineHandle shadowInstancedPipeline;
+    UploadAllocation frameConstants;
+    // Frame constants as seen from the light, one copy per cascade.
+    UploadAllocation shadowConstants[ShadowCascades::MaxCascades];
+    UploadAllocation materialTable;
+    UploadAllocation objectTable;
+    // InstanceData of every instance group, back to back; a group starts at
+    // its entry in instanceOffsets. Within a group the instances in the
+    // frustum come first, so the camera draws the first
+    // visibleInstanceCounts of them and shadow passes all of them.
+    UploadAllocation instanceData;
+    std::vector<uint32_t> instanceOffsets;
+    std::vector<uint32_t> visibleInstanceCounts;
+    // Of the frame's camera, set in update().
+    Frustum frustum;
+    std::vector<uint32_t> visibleIndices;
+    std::vector<TextureHandle> textures;
+    // All meshes share one vertex buffer, so draws only differ in their
+    // arguments and a single indirect call can cover them.
+    BufferHandle geometryBuffer;
+    std::vector<uint32_t> meshFirstVertex;
+    std::vector<BundleHandle> meshBundles;
+
+    // Geometry and textures arrive through the copy queue; until then the
+    // objects using them are skipped.
+    bool geometryReady = false;
+    std::vector<uint8_t> materialReady;
+    bool allResourcesReady = false;
+
+    RenderQueue queue;
+    RendererStats stats;
+    ShadowCascades shadows;
+
+    void updateResourceReadiness();
+    static uint32_t getPermutation(const Material& material, bool instanced);
+    bool isInstancedPipeline(uint32_t pipeline) const;
+    uint32_t getRecorderCount(size_t packetCount) const;
+    // Leaves the indices of the bounds in the frustum in visibleIndices, and
+    // adds the time it took to cullMs.
+    void findVisible(const CullingBounds& bounds, double& cullMs);
+    void updateInstances();
+    // Shadow passes go before the frame: the static layers that went stale,
+    // then the dynamic objects on top of the cached ones.
+    void recordShadows();
+    void recordShadowCasters(CommandRecorder& commands, uint32_t cascade, bool dynamic);
+    // Fills the render queue with a packet per object and instance group
+    // that can be drawn, and sorts it.
+    void buildQueue();
+    void recordPackets(CommandRecorder& commands, size_t first, size_t last);
+    void recordIndirectDraws(CommandRecorder& commands);
+    // One IndirectDrawCommand per packet, in queue order.
+    void buildIndirectDraws(IndirectDrawCommand* draws) const;
+};
@@ -0,0 +1,139 @@
+#pragma once
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "FrustumCulling.h"
+#include "ShaderTypes.h"
+
+// Movement requested for the current frame, filled by the window layer.
+// Every simulation step in the frame applies it.
+struct CameraInput
+{
+    bool left = false;
+    bool right = false;
+    bool forward = false;
+    bool back = false;
+    bool turnLeft = false;
+    bool turnRight = false;
+    // Mouse look for this step, in radians; positive turns left.
+    float turn = 0.0f;
+};
+
+// Bounds of the vertices in the mesh's own space: an AABB of half size
+// extents and the smallest sphere around its center.
+struct Mesh
+{
+    const Vertex* vertices;
+    uint32_t vertexCount;
+    XMFLOAT3 center;
+    XMFLOAT3 extents;
+    float radius;
+};
+
+// texture indexes the textures the renderer was given. lit and textured
+// pick the shader permutation the material is drawn with.
+struct Material
+{
+    uint32_t texture = 0;
+    XMFLOAT4 color = { 1.0f, 1.0f, 1.0f, 1.0f };
+    bool lit = true;
+    bool textured = true;
+};
+
+// world places the mesh in the scene, so one mesh can be drawn many times.
+// Dynamic objects are expected to move often; their shadows are drawn every
+// frame instead of being cached with the static ones.
+struct SceneObject
+{
+    uint32_t mesh;
+    uint32_t material = 0;
+    XMFLOAT4X4 world = {
+        1.0f, 0.0f, 0.0f, 0.0f,
+        0.0f, 1.0f, 0.0f, 0.0f,
+        0.0f, 0.0f, 1.0f, 0.0f,
+        0.0f, 0.0f, 0.0f, 1.0f
+    };
+    bool dynamic = false;
+};
+
+// One copy in an instance group. tint multiplies the material color.
+struct Instance
+{
+    XMFLOAT4X4 world;
+    XMFLOAT4 tint = { 1.0f, 1.0f, 1.0f, 1.0f };
+    bool lit = true;
+};
+
+// Copies of one mesh, drawn with a single instanced draw. bounds has the
+// world space bounds of every instance, in the same order.
+struct InstanceGroup
+{
+    uint32_t mesh;
+    uint32_t material = 0;
+    std::vector<Instance> instances;
+    CullingBounds bounds;
+};
+
+class Scene
+{
+public:
+    // Camera speeds per second. At 60 steps per second they match the old
+    // per-frame 0.1 units and 0.02 radians.
+    static constexpr float CameraSpeed = 6.0f;
+    static constexpr float CameraTurnSpeed = 1.2f;
+
+    void init();
+    // One simulation step of the given length. The state before it is kept
+    // for getCameraMatrix() to interpolate from.
+    void updateCamera(const CameraInput& input, float seconds);
+    void addObject(const SceneObject& object);
+    uint32_t addMaterial(const Material& material);
+    void setObjectWorld(size_t object, FXMMATRIX world);
+    uint32_t addInstanceGroup(uint32_t mesh, uint32_t material = 0);
+    void addInstance(uint32_t group, const Instance& instance);
+    // Stress test: replaces the stress groups' instances with count copies of
+    // the tree and the rock laid out on a grid; 0 removes them.
+    void setStressInstances(uint32_t count);
+
+    const std::vector<Mesh>& getMeshes() const { return meshes; }
+    const std::vector<Material>& getMaterials() const { return materials; }
+    const std::vector<SceneObject>& getObjects() const { return objects; }
+    const std::vector<InstanceGroup>& getInstanceGroups() const { return instanceGroups; }
+    // World space bounds of every object, kept up to date as they move.
+    const CullingBounds& getObjectBounds() const { return objectBounds; }
+    // View matrix between the camera before and after the last step;
+    // interpolation 1 is the latest state.
+    XMMATRIX getCameraMatrix(float interpolation = 1.0f) const;
+    // Changes whenever static geometry, i.e. anything but dynamic objects,
+    // is added or moved.
+    uint64_t getStaticVersion() const { return staticVersion; }
+
+private:
+    std::vector<Mesh> meshes;
+    std::vector<Material> materials;
+    std::vector<SceneObject> objects;
+    std::vector<InstanceGroup> instanceGroups;
+    CullingBounds objectBounds;
+    // Rotation of the view about the vertical axis, then an offset in view
+    // space along x and z.
+    struct CameraState
+    {
+        float yaw = 0.0f;
+        float x = 0.0f;
+        float z = 0.0f;
+    };
+
+    uint32_t stressGroups[2];
+    CameraState camera;
+    CameraState previousCamera;
+    uint64_t staticVersion = 0;
+
+    uint32_t addMesh(std::pair<Vertex*, size_t> vertices);
+
+    static std::pair<Vertex*, size_t> getVertices();
+    static std::pair<Vertex*, size_t> getHouseVertices();
+    static std::pair<Vertex*, size_t> getGroundVertices();
+    static std::pair<Vertex*, size_t> getRockVertices();
+};
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <cstdint>
+
+#include <DirectXMath.h>
+
+using namespace DirectX;
+
+// CPU side mirrors of the structures used by VertexShader.hlsl and
+// PixelShader.hlsl.
+
+struct Vertex
+{
+    float position[3];
+    float normal[3];
+    float color[4];
+    float tex_coord[2];
+};
+
+// Per-frame constants, shared by every draw. dirLight is in view space. Each
+// shadow pass gets a copy with matViewProj set to its cascade's matShadow.
+struct vs_const_buffer_t {
+    XMFLOAT4X4 matViewProj;
+    XMFLOAT4X4 matView;
+    XMFLOAT4 colLight;
+    XMFLOAT4 dirLight;
+
+    // World space to shadow map clip space, one per cascade.
+    XMFLOAT4X4 matShadow[4];
+    // View space depth where each cascade ends.
+    XMFLOAT4 cascadeSplits;
+    // x: cascade count, 0 without shadows; y: depth bias; z: how much of the
+    // light a shadow takes away.
+    XMFLOAT4 shadowParams;
+
+    XMFLOAT4 padding[(512 - 6 * sizeof(XMFLOAT4X4) - 4 * sizeof(XMFLOAT4)) / sizeof(XMFLOAT4)];
+};
+
+// One entry of the object table, a StructuredBuffer<object_t> indexed by the
+// draw's object ID. Normals go through matWorld as well, so it should not
+// scale non-uniformly.
+struct ObjectParams
+{
+    XMFLOAT4X4 matWorld;
+};
+
+// Per-instance vertex stream of ShaderProgram::SceneInstanced, instance_t in
+// VertexShader.hlsl. world holds the first three columns of the world matrix,
+// which is all an affine transform needs; tint is RGBA8.
+struct InstanceData
+{
+    XMFLOAT4 world[3];
+    uint32_t tint;
+    uint32_t lit;
+};
+
+// One entry of the material table, a StructuredBuffer<material_t> indexed by
+// the draw's material ID. textureIndex is the texture's place in the bindless
+// range, see RenderBackend::getTextureIndex.
+struct MaterialParams
+{
+    XMFLOAT4 color;
+    uint32_t textureIndex;
+    uint32_t padding[3];
+};
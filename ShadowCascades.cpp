@@ -0,0 +1,98 @@
+#include "ShadowCascades.h"
+
+#include <algorithm>
+#include <cmath>
+
+void ShadowCascades::init(const ShadowSettings& settings)
+{
+    this->settings = settings;
+    this->settings.cascadeCount = std::min(std::max(settings.cascadeCount, 1u), MaxCascades);
+    invalidate();
+    stats = {};
+}
+
+void ShadowCascades::invalidate()
+{
+    for (Page& page : pages)
+        page.valid = false;
+}
+
+void ShadowCascades::update(FXMMATRIX view, float fovY, float aspect, float nearPlane, FXMVECTOR lightDirection,
+    uint64_t staticVersion)
+{
+    stats.updates++;
+
+    XMFLOAT3 direction;
+    XMStoreFloat3(&direction, XMVector3Normalize(lightDirection));
+    if (direction.x != this->lightDirection.x || direction.y != this->lightDirection.y
+        || direction.z != this->lightDirection.z || staticVersion != this->staticVersion)
+    {
+        invalidate();
+        this->lightDirection = direction;
+        this->staticVersion = staticVersion;
+    }
+
+    // Any fixed up vector works as long as it does not follow the camera,
+    // otherwise the texel snapping would not hold.
+    const XMVECTOR up = std::fabs(direction.y) > 0.99f ? XMVectorSet(0.0f, 0.0f, 1.0f, 0.0f)
+        : XMVectorSet(0.0f, 1.0f, 0.0f, 0.0f);
+    const XMMATRIX lightView = XMMatrixLookToLH(XMVectorSet(0.0f, 0.0f, 0.0f, 1.0f), XMLoadFloat3(&direction), up);
+    const XMMATRIX inverseView = XMMatrixInverse(nullptr, view);
+
+    // Squared slope of the frustum's corner edges.
+    const float tanY = std::tan(fovY * 0.5f);
+    const float tanX = tanY * aspect;
+    const float cornerSlope = tanX * tanX + tanY * tanY;
+
+    const float farPlane = settings.maxDistance;
+    const uint32_t count = settings.cascadeCount;
+    float sliceNear = nearPlane;
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        const float t = static_cast<float>(i + 1) / count;
+        const float uniformSplit = nearPlane + (farPlane - nearPlane) * t;
+        const float logSplit = nearPlane * std::pow(farPlane / nearPlane, t);
+        const float sliceFar = uniformSplit + (logSplit - uniformSplit) * settings.splitLambda;
+
+        // Smallest sphere through the slice's corners has its center on the
+        // view axis, equally far from the near and far corners.
+        const float centerDepth = std::min((sliceNear + sliceFar) * (1.0f + cornerSlope) * 0.5f, sliceFar);
+        const float radius = std::sqrt((sliceFar - centerDepth) * (sliceFar - centerDepth)
+            + sliceFar * sliceFar * cornerSlope);
+
+        const XMVECTOR worldCenter = XMVector3TransformCoord(XMVectorSet(0.0f, 0.0f, centerDepth, 1.0f), inverseView);
+        XMFLOAT3 center;
+        XMStoreFloat3(&center, XMVector3TransformCoord(worldCenter, lightView));
+
+        Page& page = pages[i];
+        const float halfExtent = radius * (1.0f + settings.pageMargin);
+        const bool inside = page.valid && page.halfExtent == halfExtent
+            && std::fabs(center.x - page.center.x) + radius <= halfExtent
+            && std::fabs(center.y - page.center.y) + radius <= halfExtent
+            && std::fabs(center.z - page.center.z) + radius <= settings.depthRange;
+
+        cascades[i].staticDirty = !inside;
+        if (!inside)
+        {
+            // Whole texels only, so static casters land on the same texels in
+            // every page and moving the page does not make the edges crawl.
+            const float texelSize = 2.0f * halfExtent / settings.resolution;
+            page.center.x = std::floor(center.x / texelSize) * texelSize;
+            page.center.y = std::floor(center.y / texelSize) * texelSize;
+            page.center.z = center.z;
+            page.halfExtent = halfExtent;
+            page.valid = true;
+            stats.staticRedraws++;
+        }
+
+        const XMMATRIX projection = XMMatrixOrthographicOffCenterLH(
+            page.center.x - page.halfExtent, page.center.x + page.halfExtent,
+            page.center.y - page.halfExtent, page.center.y + page.halfExtent,
+            page.center.z - settings.depthRange, page.center.z + settings.depthRange);
+        XMStoreFloat4x4(&cascades[i].viewProj, XMMatrixMultiply(lightView, projection));
+        cascades[i].splitDepth = sliceFar;
+
+        sliceNear = sliceFar;
+    }
+}
@@ -0,0 +1,86 @@
+#pragma once
+
+#include <cstdint>
+
+#include <DirectXMath.h>
+
+using namespace DirectX;
+
+struct ShadowSettings
+{
+    uint32_t cascadeCount = 4;
+    // Width and height of one cascade's shadow map.
+    uint32_t resolution = 2048;
+    // View space depth where shadows end.
+    float maxDistance = 60.0f;
+    // Blend between uniform (0) and logarithmic (1) split distances.
+    float splitLambda = 0.75f;
+    // Room around each cascade's bounding sphere, relative to its radius. The
+    // cached page only moves once the sphere leaves it.
+    float pageMargin = 0.25f;
+    // Light space depth covered on each side of a page's center. Casters
+    // closer to the light are clamped by the shadow pipeline, not clipped.
+    float depthRange = 100.0f;
+};
+
+struct ShadowCascade
+{
+    // World space to the cascade's shadow map clip space, not transposed.
+    XMFLOAT4X4 viewProj;
+    // View space depth where the cascade ends.
+    float splitDepth;
+    // The static layer was drawn for another page and has to be drawn again.
+    bool staticDirty;
+};
+
+// Fits cascaded shadow maps for a directional light to the camera frustum and
+// tracks when their cached static layers go stale. A cascade is the bounding
+// sphere of its slice of the frustum, so its size does not change as the
+// camera turns. It is placed in a somewhat larger page, snapped to shadow map
+// texels; the page, and the static casters drawn into it, stay valid until the
+// sphere leaves it, the light turns or the static geometry changes.
+class ShadowCascades
+{
+public:
+    static constexpr uint32_t MaxCascades = 4;
+
+    struct Stats
+    {
+        uint64_t updates;
+        // Static layers that had to be drawn again.
+        uint64_t staticRedraws;
+    };
+
+    void init(const ShadowSettings& settings);
+
+    // view is the camera's view matrix and fovY, aspect and nearPlane its
+    // projection. lightDirection points from the light into the scene, in
+    // world space. staticVersion has to change whenever a static caster was
+    // added, removed or moved.
+    void update(FXMMATRIX view, float fovY, float aspect, float nearPlane, FXMVECTOR lightDirection,
+        uint64_t staticVersion);
+    // Makes the next update() redraw every static layer, e.g. when the last
+    // ones were drawn without all the geometry.
+    void invalidate();
+
+    uint32_t getCascadeCount() const { return settings.cascadeCount; }
+    const ShadowCascade& getCascade(uint32_t cascade) const { return cascades[cascade]; }
+    const ShadowSettings& getSettings() const { return settings; }
+    const Stats& getStats() const { return stats; }
+
+private:
+    // Light space box the static layer was drawn for.
+    struct Page
+    {
+        bool valid;
+        XMFLOAT3 center;
+        float halfExtent;
+    };
+
+    ShadowSettings settings;
+    ShadowCascade cascades[MaxCascades] = {};
+    Page pages[MaxCascades] = {};
+    XMFLOAT3 lightDirection = { 0.0f, 0.0f, 0.0f };
+    uint64_t staticVersion = 0;
+    Stats stats = {};
+};
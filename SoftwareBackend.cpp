@@ -0,0 +1,552 @@
+#include "SoftwareBackend.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace
+{
+    uint32_t packColor(float r, float g, float b, float a)
+    {
+        auto channel = [](float value) {
+            return static_cast<uint32_t>(std::min(std::max(value, 0.0f), 1.0f) * 255.0f + 0.5f);
+        };
+        return channel(r) | (channel(g) << 8) | (channel(b) << 16) | (channel(a) << 24);
+    }
+
+    // row * matrix, matrix stored transposed the way update() uploads it.
+    void transform(const XMFLOAT4X4& m, const float v[4], float out[4])
+    {
+        for (int j = 0; j < 4; j++)
+            out[j] = v[0] * m.m[j][0] + v[1] * m.m[j][1] + v[2] * m.m[j][2] + v[3] * m.m[j][3];
+    }
+
+    void normalize4(float v[4])
+    {
+        const float length = std::sqrt(v[0] * v[0] + v[1] * v[1] + v[2] * v[2] + v[3] * v[3]);
+        if (length > 0.0f)
+        {
+            for (int i = 0; i < 4; i++)
+                v[i] /= length;
+        }
+    }
+}
+
+void SoftwareCommandRecorder::setPipeline(PipelineHandle pipeline)
+{
+    commands.push_back({ Type::SetPipeline, pipeline.id });
+}
+
+void SoftwareCommandRecorder::setConstantBuffer(BufferHandle buffer, size_t offset)
+{
+    commands.push_back({ Type::SetConstantBuffer, buffer.id, static_cast<uint32_t>(offset) });
+}
+
+void SoftwareCommandRecorder::setMaterialTable(BufferHandle buffer, size_t offset)
+{
+    commands.push_back({ Type::SetMaterialTable, buffer.id, static_cast<uint32_t>(offset) });
+}
+
+void SoftwareCommandRecorder::setMaterial(uint32_t material)
+{
+    commands.push_back({ Type::SetMaterial, material });
+}
+
+void SoftwareCommandRecorder::setObjectTable(BufferHandle buffer, size_t offset)
+{
+    commands.push_back({ Type::SetObjectTable, buffer.id, static_cast<uint32_t>(offset) });
+}
+
+void SoftwareCommandRecorder::setObject(uint32_t object)
+{
+    commands.push_back({ Type::SetObject, object });
+}
+
+void SoftwareCommandRecorder::setVertexBuffer(BufferHandle buffer)
+{
+    commands.push_back({ Type::SetVertexBuffer, buffer.id });
+}
+
+void SoftwareCommandRecorder::setInstanceBuffer(BufferHandle buffer, size_t offset, uint32_t instanceCount)
+{
+    commands.push_back({ Type::SetInstanceBuffer, buffer.id, static_cast<uint32_t>(offset), instanceCount });
+}
+
+void SoftwareCommandRecorder::draw(uint32_t vertexCount, uint32_t instanceCount,
+    uint32_t firstVertex, uint32_t firstInstance)
+{
+    commands.push_back({ Type::Draw, 0, 0, vertexCount, instanceCount, firstVertex, firstInstance });
+}
+
+void SoftwareCommandRecorder::drawIndirect(BufferHandle buffer, size_t offset, uint32_t drawCount)
+{
+    commands.push_back({ Type::DrawIndirect, buffer.id, static_cast<uint32_t>(offset), drawCount });
+}
+
+void SoftwareCommandRecorder::executeBundle(BundleHandle bundle)
+{
+    commands.push_back({ Type::ExecuteBundle, bundle.id });
+}
+
+void SoftwareBackend::init(uint32_t width, uint32_t height)
+{
+    resize(width, height);
+
+    BufferDesc uploadDesc;
+    uploadDesc.size = UploadRingSize;
+    uploadDesc.usage = BufferUsage::Constant;
+    uploadBuffer = createBuffer(uploadDesc);
+    uploadRing.init(UploadRingSize);
+}
+
+void SoftwareBackend::resize(uint32_t width, uint32_t height)
+{
+    this->width = width;
+    this->height = height;
+
+    colorBuffer.assign(static_cast<size_t>(width) * height, 0);
+    depthBuffer.assign(static_cast<size_t>(width) * height, 1.0f);
+}
+
+void SoftwareBackend::destroy()
+{
+    buffers.clear();
+    textures.clear();
+    pipelines.clear();
+}
+
+BufferHandle SoftwareBackend::createBuffer(const BufferDesc& desc)
+{
+    std::vector<uint8_t> buffer(desc.size);
+    if (desc.initialData)
+        memcpy(buffer.data(), desc.initialData, desc.size);
+
+    buffers.push_back(std::move(buffer));
+    return { static_cast<uint32_t>(buffers.size()) };
+}
+
+void SoftwareBackend::destroyBuffer(BufferHandle buffer)
+{
+    std::vector<uint8_t>().swap(buffers[buffer.id - 1]);
+}
+
+void* SoftwareBackend::mapBuffer(BufferHandle buffer)
+{
+    return buffers[buffer.id - 1].data();
+}
+
+TextureHandle SoftwareBackend::createTexture(const TextureDesc& desc)
+{
+    // The D3D12 texture has a single mip level, keep the same look here.
+    textures.emplace_back(desc.pixels, desc.width, desc.height, false);
+    return { static_cast<uint32_t>(textures.size()) };
+}
+
+PipelineHandle SoftwareBackend::createPipeline(const PipelineDesc& desc)
+{
+    pipelines.push_back(desc);
+    return { static_cast<uint32_t>(pipelines.size()) };
+}
+
+CommandRecorder& SoftwareBackend::beginBundle()
+{
+    bundleRecorder.reset();
+    return bundleRecorder;
+}
+
+BundleHandle SoftwareBackend::endBundle()
+{
+    bundles.push_back(bundleRecorder.takeCommands());
+    return { static_cast<uint32_t>(bundles.size()) };
+}
+
+CommandRecorder& SoftwareBackend::beginShadowPass(ShadowLayer, uint32_t)
+{
+    shadowRecorder.reset();
+    return shadowRecorder;
+}
+
+CommandRecorder& SoftwareBackend::beginFrame(const float clearColor[4])
+{
+    std::fill(colorBuffer.begin(), colorBuffer.end(),
+        packColor(clearColor[0], clearColor[1], clearColor[2], clearColor[3]));
+    std::fill(depthBuffer.begin(), depthBuffer.end(), 1.0f);
+
+    recorder.reset();
+    return recorder;
+}
+
+CommandRecorder& SoftwareBackend::beginParallelRecorder(uint32_t index)
+{
+    parallelRecorders[index].reset();
+    parallelUsed[index] = true;
+    return parallelRecorders[index];
+}
+
+void SoftwareBackend::submitFrame()
+{
+    // Every list starts without bindings, like a fresh D3D12 command list.
+    DrawState state;
+    execute(recorder.getCommands(), state);
+
+    for (uint32_t i = 0; i < MaxParallelRecorders; i++)
+    {
+        if (!parallelUsed[i])
+            continue;
+
+        DrawState parallelState;
+        execute(parallelRecorders[i].getCommands(), parallelState);
+        parallelUsed[i] = false;
+    }
+}
+
+void SoftwareBackend::execute(const std::vector<SoftwareCommandRecorder::Command>& commands, DrawState& state)
+{
+    for (const SoftwareCommandRecorder::Command& command : commands)
+    {
+        switch (command.type)
+        {
+        case SoftwareCommandRecorder::Type::SetPipeline:
+            state.pipeline = &pipelines[command.handle - 1];
+            break;
+
+        case SoftwareCommandRecorder::Type::SetConstantBuffer:
+            state.constants = reinterpret_cast<const vs_const_buffer_t*>(buffers[command.handle - 1].data() + command.offset);
+            break;
+
+        case SoftwareCommandRecorder::Type::SetMaterialTable:
+            state.materials = reinterpret_cast<const MaterialParams*>(buffers[command.handle - 1].data() + command.offset);
+            break;
+
+        case SoftwareCommandRecorder::Type::SetMaterial:
+            state.material = command.handle;
+            break;
+
+        case SoftwareCommandRecorder::Type::SetObjectTable:
+            state.objects = reinterpret_cast<const ObjectParams*>(buffers[command.handle - 1].data() + command.offset);
+            break;
+
+        case SoftwareCommandRecorder::Type::SetObject:
+            state.object = command.handle;
+            break;
+
+        case SoftwareCommandRecorder::Type::SetVertexBuffer:
+            state.vertices = &buffers[command.handle - 1];
+            break;
+
+        case SoftwareCommandRecorder::Type::SetInstanceBuffer:
+            state.instances = reinterpret_cast<const InstanceData*>(buffers[command.handle - 1].data() + command.offset);
+            state.instanceCount = command.vertexCount;
+            break;
+
+        case SoftwareCommandRecorder::Type::Draw:
+            draw(state, command.vertexCount, command.instanceCount, command.firstVertex, command.firstInstance);
+            break;
+
+        case SoftwareCommandRecorder::Type::DrawIndirect:
+        {
+            const IndirectDrawCommand* draws = reinterpret_cast<const IndirectDrawCommand*>(
+                buffers[command.handle - 1].data() + command.offset);
+            for (uint32_t i = 0; i < command.vertexCount; i++)
+            {
+                state.material = draws[i].material;
+                state.object = draws[i].object;
+                draw(state, draws[i].vertexCount, draws[i].instanceCount, draws[i].firstVertex, draws[i].firstInstance);
+            }
+            break;
+        }
+
+        case SoftwareCommandRecorder::Type::ExecuteBundle:
+            execute(bundles[command.handle - 1], state);
+            break;
+        }
+    }
+}
+
+void SoftwareBackend::draw(DrawState& state, uint32_t vertexCount, uint32_t instanceCount,
+    uint32_t firstVertex, uint32_t firstInstance)
+{
+    if (!state.pipeline || !state.constants || !state.vertices || !state.materials)
+        return;
+
+    const bool instanced = state.pipeline->program == ShaderProgram::SceneInstanced;
+    if (instanced ? !state.instances : !state.objects)
+        return;
+
+    state.drawMaterial = &state.materials[state.material];
+    state.texture = state.pipeline->textured ? &textures[state.drawMaterial->textureIndex] : nullptr;
+
+    if (!instanced)
+    {
+        state.drawInstance = { state.objects[state.object].matWorld, { 1.0f, 1.0f, 1.0f, 1.0f }, state.pipeline->lit };
+        for (uint32_t instance = 0; instance < instanceCount; instance++)
+            drawTriangles(state, firstVertex, vertexCount);
+        return;
+    }
+
+    const uint32_t lastInstance = std::min(firstInstance + instanceCount, state.instanceCount);
+    for (uint32_t instance = firstInstance; instance < lastInstance; instance++)
+    {
+        const InstanceData& data = state.instances[instance];
+        DrawInstance& drawInstance = state.drawInstance;
+        memcpy(drawInstance.world.m, data.world, sizeof(data.world));
+        drawInstance.world.m[3][0] = drawInstance.world.m[3][1] = drawInstance.world.m[3][2] = 0.0f;
+        drawInstance.world.m[3][3] = 1.0f;
+        for (int channel = 0; channel < 4; channel++)
+            drawInstance.tint[channel] = static_cast<float>((data.tint >> (8 * channel)) & 0xff) / 255.0f;
+        drawInstance.lit = state.pipeline->lit && data.lit != 0;
+        drawTriangles(state, firstVertex, vertexCount);
+    }
+}
+
+void SoftwareBackend::present()
+{
+    // The frame was drawn in submitFrame, its upload memory is free already.
+    frames++;
+    uploadRing.finishFrame(frames);
+    uploadRing.retire(frames);
+}
+
+UploadAllocation SoftwareBackend::allocateUpload(size_t size, size_t alignment)
+{
+    size_t offset;
+    if (!uploadRing.allocate(size, alignment, offset))
+        return UploadAllocation();
+
+    return { uploadBuffer, offset, buffers[uploadBuffer.id - 1].data() + offset };
+}
+
+SoftwareBackend::ShadedVertex SoftwareBackend::shadeVertex(const vs_const_buffer_t& constants,
+    const MaterialParams& material, const DrawInstance& instance, const Vertex& vertex)
+{
+    ShadedVertex out;
+
+    const float position[4] = { vertex.position[0], vertex.position[1], vertex.position[2], 1.0f };
+    float worldPosition[4];
+    transform(instance.world, position, worldPosition);
+    transform(constants.matViewProj, worldPosition, out.clip);
+
+    const float color[4] = {
+        vertex.color[0] * material.color.x * instance.tint[0], vertex.color[1] * material.color.y * instance.tint[1],
+        vertex.color[2] * material.color.z * instance.tint[2], vertex.color[3] * material.color.w * instance.tint[3]
+    };
+
+    if (instance.lit)
+    {
+        const float normal[4] = { vertex.normal[0], vertex.normal[1], vertex.normal[2], 0.0f };
+        float NW[4], worldNormal[4];
+        float LW[4] = { constants.dirLight.x, constants.dirLight.y, constants.dirLight.z, constants.dirLight.w };
+        transform(instance.world, normal, worldNormal);
+        transform(constants.matView, worldNormal, NW);
+        normalize4(NW);
+        normalize4(LW);
+
+        const float intensity = std::max(-(LW[0] * NW[0] + LW[1] * NW[1] + LW[2] * NW[2] + LW[3] * NW[3]), 0.0f);
+        out.color[0] = intensity * constants.colLight.x * color[0];
+        out.color[1] = intensity * constants.colLight.y * color[1];
+        out.color[2] = intensity * constants.colLight.z * color[2];
+        out.color[3] = intensity * constants.colLight.w * color[3];
+    }
+    else
+    {
+        memcpy(out.color, color, sizeof(out.color));
+    }
+
+    out.uv[0] = vertex.tex_coord[0];
+    out.uv[1] = vertex.tex_coord[1];
+    return out;
+}
+
+void SoftwareBackend::drawTriangles(const DrawState& state, uint32_t firstVertex, uint32_t vertexCount)
+{
+    const size_t available = state.vertices->size() / sizeof(Vertex);
+    if (firstVertex >= available)
+        return;
+    vertexCount = static_cast<uint32_t>(std::min<size_t>(vertexCount, available - firstVertex));
+
+    const Vertex* vertices = reinterpret_cast<const Vertex*>(state.vertices->data()) + firstVertex;
+
+    for (uint32_t i = 0; i + 2 < vertexCount; i += 3)
+    {
+        const ShadedVertex triangle[3] = {
+            shadeVertex(*state.constants, *state.drawMaterial, state.drawInstance, vertices[i]),
+            shadeVertex(*state.constants, *state.drawMaterial, state.drawInstance, vertices[i + 1]),
+            shadeVertex(*state.constants, *state.drawMaterial, state.drawInstance, vertices[i + 2])
+        };
+
+        // Clip against the near plane (z >= 0 in D3D clip space), which leaves
+        // at most a quad.
+        ShadedVertex polygon[4];
+        uint32_t count = 0;
+        for (uint32_t e = 0; e < 3; e++)
+        {
+            const ShadedVertex& p = triangle[e];
+            const ShadedVertex& q = triangle[(e + 1) % 3];
+            const bool pInside = p.clip[2] >= 0.0f;
+            const bool qInside = q.clip[2] >= 0.0f;
+
+            if (pInside)
+                polygon[count++] = p;
+            if (pInside != qInside)
+            {
+                const float t = p.clip[2] / (p.clip[2] - q.clip[2]);
+                ShadedVertex& v = polygon[count++];
+                for (int k = 0; k < 4; k++)
+                {
+                    v.clip[k] = p.clip[k] + (q.clip[k] - p.clip[k]) * t;
+                    v.color[k] = p.color[k] + (q.color[k] - p.color[k]) * t;
+                }
+                for (int k = 0; k < 2; k++)
+                    v.uv[k] = p.uv[k] + (q.uv[k] - p.uv[k]) * t;
+            }
+        }
+
+        for (uint32_t k = 1; k + 1 < count; k++)
+            rasterizeTriangle(state, polygon[0], polygon[k], polygon[k + 1]);
+    }
+}
+
+void SoftwareBackend::rasterizeTriangle(const DrawState& state,
+    const ShadedVertex& a, const ShadedVertex& b, const ShadedVertex& c)
+{
+    const ShadedVertex* v[3] = { &a, &b, &c };
+    float x[3], y[3], z[3], invW[3];
+
+    for (int i = 0; i < 3; i++)
+    {
+        invW[i] = 1.0f / v[i]->clip[3];
+        x[i] = (v[i]->clip[0] * invW[i] * 0.5f + 0.5f) * static_cast<float>(width);
+        y[i] = (0.5f - v[i]->clip[1] * invW[i] * 0.5f) * static_cast<float>(height);
+        z[i] = v[i]->clip[2] * invW[i];
+    }
+
+    // Clockwise on screen is front facing (FrontCounterClockwise = FALSE).
+    float area = (x[1] - x[0]) * (y[2] - y[0]) - (y[1] - y[0]) * (x[2] - x[0]);
+    if (area == 0.0f)
+        return;
+    if (area < 0.0f)
+    {
+        if (state.pipeline->cullBackFaces)
+            return;
+        std::swap(v[1], v[2]);
+        std::swap(x[1], x[2]);
+        std::swap(y[1], y[2]);
+        std::swap(z[1], z[2]);
+        std::swap(invW[1], invW[2]);
+        area = -area;
+    }
+
+    const int minX = std::max(0, static_cast<int>(std::floor(std::min({ x[0], x[1], x[2] }))));
+    const int maxX = std::min(static_cast<int>(width) - 1, static_cast<int>(std::ceil(std::max({ x[0], x[1], x[2] }))));
+    const int minY = std::max(0, static_cast<int>(std::floor(std::min({ y[0], y[1], y[2] }))));
+    const int maxY = std::min(static_cast<int>(height) - 1, static_cast<int>(std::ceil(std::max({ y[0], y[1], y[2] }))));
+    if (minX > maxX || minY > maxY)
+        return;
+
+    // Barycentric weights are affine in screen space: l[i] = (dx[i] * px + dy[i] * py + c0[i]) / area.
+    float dx[3], dy[3], c0[3];
+    for (int i = 0; i < 3; i++)
+    {
+        const int j = (i + 1) % 3;
+        const int k = (i + 2) % 3;
+        dx[i] = (y[j] - y[k]) / area;
+        dy[i] = (x[k] - x[j]) / area;
+        c0[i] = ((x[j] * y[k]) - (x[k] * y[j])) / area;
+    }
+
+    // Perspective correct u/w, v/w and 1/w gradients for the LOD.
+    float dUdx = 0, dUdy = 0, dVdx = 0, dVdy = 0, dWdx = 0, dWdy = 0;
+    for (int i = 0; i < 3; i++)
+    {
+        dUdx += dx[i] * v[i]->uv[0] * invW[i];
+        dUdy += dy[i] * v[i]->uv[0] * invW[i];
+        dVdx += dx[i] * v[i]->uv[1] * invW[i];
+        dVdy += dy[i] * v[i]->uv[1] * invW[i];
+        dWdx += dx[i] * invW[i];
+        dWdy += dy[i] * invW[i];
+    }
+
+    PixelBatch batch;
+
+    for (int py = minY; py <= maxY; py++)
+    {
+        const float fy = static_cast<float>(py) + 0.5f;
+        for (int px = minX; px <= maxX; px++)
+        {
+            const float fx = static_cast<float>(px) + 0.5f;
+
+            float l[3];
+            bool inside = true;
+            for (int i = 0; i < 3; i++)
+            {
+                l[i] = dx[i] * fx + dy[i] * fy + c0[i];
+                inside = inside && l[i] >= 0.0f;
+            }
+            if (!inside)
+                continue;
+
+            const float depth = l[0] * z[0] + l[1] * z[1] + l[2] * z[2];
+            const size_t index = static_cast<size_t>(py) * width + px;
+            if (depth > 1.0f)
+                continue;
+            if (state.pipeline->depthTest && !(depth < depthBuffer[index]))
+                continue;
+            if (state.pipeline->depthWrite)
+                depthBuffer[index] = depth;
+
+            const float W = l[0] * invW[0] + l[1] * invW[1] + l[2] * invW[2];
+            const float U = l[0] * v[0]->uv[0] * invW[0] + l[1] * v[1]->uv[0] * invW[1] + l[2] * v[2]->uv[0] * invW[2];
+            const float V = l[0] * v[0]->uv[1] * invW[0] + l[1] * v[1]->uv[1] * invW[1] + l[2] * v[2]->uv[1] * invW[2];
+
+            const uint32_t slot = batch.count++;
+            batch.index[slot] = static_cast<uint32_t>(index);
+            batch.u[slot] = U / W;
+            batch.v[slot] = V / W;
+            for (int k = 0; k < 4; k++)
+            {
+                batch.color[k][slot] = (l[0] * v[0]->color[k] * invW[0] + l[1] * v[1]->color[k] * invW[1]
+                    + l[2] * v[2]->color[k] * invW[2]) / W;
+            }
+
+            if (state.texture)
+            {
+                const float W2 = W * W;
+                batch.lod[slot] = state.texture->computeLod(
+                    (dUdx * W - U * dWdx) / W2, (dVdx * W - V * dWdx) / W2,
+                    (dUdy * W - U * dWdy) / W2, (dVdy * W - V * dWdy) / W2);
+            }
+
+            if (batch.count == PixelBatch::Size)
+                flushBatch(state, batch);
+        }
+    }
+
+    flushBatch(state, batch);
+}
+
+void SoftwareBackend::flushBatch(const DrawState& state, PixelBatch& batch)
+{
+    if (batch.count == 0)
+        return;
+
+    float texel[4][PixelBatch::Size];
+    if (state.texture)
+    {
+        state.texture->sample(batch.u, batch.v, batch.lod, batch.count,
+            texel[0], texel[1], texel[2], texel[3]);
+    }
+    else
+    {
+        for (int k = 0; k < 4; k++)
+            std::fill(texel[k], texel[k] + batch.count, 1.0f);
+    }
+
+    for (uint32_t i = 0; i < batch.count; i++)
+    {
+        colorBuffer[batch.index[i]] = packColor(
+            batch.color[0][i] * texel[0][i], batch.color[1][i] * texel[1][i],
+            batch.color[2][i] * texel[2][i], batch.color[3][i] * texel[3][i]);
+    }
+
+    batch.count = 0;
+}
@@ -0,0 +1,193 @@
+#pragma once
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "RenderBackend.h"
+#include "ShaderTypes.h"
+#include "UploadRing.h"
+#include "TextureSampler.h"
+
+class SoftwareCommandRecorder : public CommandRecorder
+{
+public:
+    enum class Type
+    {
+        SetPipeline,
+        SetConstantBuffer,
+        SetMaterialTable,
+        SetMaterial,
+        SetObjectTable,
+        SetObject,
+        SetVertexBuffer,
+        SetInstanceBuffer,
+        Draw,
+        DrawIndirect,
+        ExecuteBundle
+    };
+
+    struct Command
+    {
+        Type type;
+        uint32_t handle = 0;
+        uint32_t offset = 0;
+        uint32_t vertexCount = 0;
+        uint32_t instanceCount = 0;
+        uint32_t firstVertex = 0;
+        uint32_t firstInstance = 0;
+    };
+
+    void setPipeline(PipelineHandle pipeline) override;
+    void setConstantBuffer(BufferHandle buffer, size_t offset) override;
+    void setMaterialTable(BufferHandle buffer, size_t offset) override;
+    void setMaterial(uint32_t material) override;
+    void setObjectTable(BufferHandle buffer, size_t offset) override;
+    void setObject(uint32_t object) override;
+    void setVertexBuffer(BufferHandle buffer) override;
+    void setInstanceBuffer(BufferHandle buffer, size_t offset, uint32_t instanceCount) override;
+    void draw(uint32_t vertexCount, uint32_t instanceCount,
+        uint32_t firstVertex, uint32_t firstInstance) override;
+    void drawIndirect(BufferHandle buffer, size_t offset, uint32_t drawCount) override;
+    void executeBundle(BundleHandle bundle) override;
+
+    void reset() { commands.clear(); }
+    const std::vector<Command>& getCommands() const { return commands; }
+    std::vector<Command> takeCommands() { return std::move(commands); }
+
+private:
+    std::vector<Command> commands;
+};
+
+// Rasterizes the scene on the CPU with the same math as VertexShader.hlsl and
+// PixelShader.hlsl, shadows aside: shadow passes are recorded but dropped, and
+// nothing is shadowed. Commands are recorded during the frame and executed in
+// submitFrame; the result stays in an RGBA8 color buffer.
+class SoftwareBackend : public RenderBackend
+{
+public:
+    void init(uint32_t width, uint32_t height) override;
+    void resize(uint32_t width, uint32_t height) override;
+    void destroy() override;
+
+    BufferHandle createBuffer(const BufferDesc& desc) override;
+    void destroyBuffer(BufferHandle buffer) override;
+    void* mapBuffer(BufferHandle buffer) override;
+    TextureHandle createTexture(const TextureDesc& desc) override;
+    uint32_t getTextureIndex(TextureHandle texture) override { return texture.id - 1; }
+    PipelineHandle createPipeline(const PipelineDesc& desc) override;
+
+    // Data is copied on creation, so everything is ready right away.
+    bool isBufferReady(BufferHandle) override { return true; }
+    bool isTextureReady(TextureHandle) override { return true; }
+    void flushUploads() override {}
+
+    CommandRecorder& beginBundle() override;
+    BundleHandle endBundle() override;
+
+    // Frames are finished inside submitFrame, nothing is ever in flight.
+    uint32_t getFramesInFlight() const override { return 1; }
+    uint32_t getFrameSlot() const override { return 0; }
+
+    UploadAllocation allocateUpload(size_t size, size_t alignment) override;
+
+    void createShadowMaps(uint32_t, uint32_t) override {}
+    CommandRecorder& beginShadowPass(ShadowLayer layer, uint32_t cascade) override;
+    CommandRecorder& beginFrame(const float clearColor[4]) override;
+
+    uint32_t getMaxParallelRecorders() const override { return MaxParallelRecorders; }
+    CommandRecorder& beginParallelRecorder(uint32_t index) override;
+
+    void submitFrame() override;
+    void present() override;
+
+    bool isTearingSupported() const override { return false; }
+    void setPresentParams(const PresentParams&) override {}
+    void waitForPresentSlot() override {}
+    const GpuProfiler* getGpuProfiler() const override { return nullptr; }
+
+    uint32_t GetWidth() const { return width; }
+    uint32_t GetHeight() const { return height; }
+    const uint32_t* getColorBuffer() const { return colorBuffer.data(); }
+    uint64_t getFrameCount() const { return frames; }
+
+private:
+    static constexpr uint32_t MaxParallelRecorders = 8;
+
+    struct ShadedVertex
+    {
+        float clip[4];
+        float color[4];
+        float uv[2];
+    };
+
+    // What the vertex shader gets per instance: the world matrix, stored
+    // transposed like ObjectParams, the tint and whether the light applies,
+    // which takes both a lit pipeline and a lit instance.
+    struct DrawInstance
+    {
+        XMFLOAT4X4 world;
+        float tint[4];
+        bool lit;
+    };
+
+    struct DrawState
+    {
+        const PipelineDesc* pipeline = nullptr;
+        const vs_const_buffer_t* constants = nullptr;
+        const MaterialParams* materials = nullptr;
+        uint32_t material = 0;
+        const ObjectParams* objects = nullptr;
+        uint32_t object = 0;
+        const InstanceData* instances = nullptr;
+        uint32_t instanceCount = 0;
+        // Resolved from the material and object or instance when drawing.
+        const MaterialParams* drawMaterial = nullptr;
+        DrawInstance drawInstance;
+        const SampledTexture* texture = nullptr;
+        const std::vector<uint8_t>* vertices = nullptr;
+    };
+
+    // Pixels waiting for a batched texture fetch.
+    struct PixelBatch
+    {
+        static const uint32_t Size = 64;
+
+        uint32_t count = 0;
+        uint32_t index[Size];
+        float u[Size], v[Size], lod[Size];
+        float color[4][Size];
+    };
+
+    uint32_t width = 0;
+    uint32_t height = 0;
+    uint64_t frames = 0;
+
+    std::vector<uint32_t> colorBuffer;
+    std::vector<float> depthBuffer;
+
+    std::vector<std::vector<uint8_t>> buffers;
+    std::vector<SampledTexture> textures;
+    std::vector<PipelineDesc> pipelines;
+
+    BufferHandle uploadBuffer;
+    UploadRing uploadRing;
+
+    SoftwareCommandRecorder recorder;
+    SoftwareCommandRecorder shadowRecorder;
+    SoftwareCommandRecorder bundleRecorder;
+    SoftwareCommandRecorder parallelRecorders[MaxParallelRecorders];
+    bool parallelUsed[MaxParallelRecorders] = {};
+    std::vector<std::vector<SoftwareCommandRecorder::Command>> bundles;
+
+    void execute(const std::vector<SoftwareCommandRecorder::Command>& commands, DrawState& state);
+
+    void draw(DrawState& state, uint32_t vertexCount, uint32_t instanceCount,
+        uint32_t firstVertex, uint32_t firstInstance);
+    void drawTriangles(const DrawState& state, uint32_t firstVertex, uint32_t vertexCount);
+    void rasterizeTriangle(const DrawState& state, const ShadedVertex& a, const ShadedVertex& b, const ShadedVertex& c);
+    void flushBatch(const DrawState& state, PixelBatch& batch);
+
+    static ShadedVertex shadeVertex(const vs_const_buffer_t& constants, const MaterialParams& material,
+        const DrawInstance& instance, const Vertex& vertex);
+};
@@ -0,0 +1,309 @@
+#include "TextureSampler.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+namespace
+{
+    // Spreads the low 3 bits of v to even bit positions (xyz -> x0y0z).
+    inline uint32_t spread3(uint32_t v)
+    {
+        return (v & 1u) | ((v & 2u) << 1) | ((v & 4u) << 2);
+    }
+
+    inline uint32_t wrapCoord(int32_t c, uint32_t size)
+    {
+        int32_t r = c % static_cast<int32_t>(size);
+        return static_cast<uint32_t>(r < 0 ? r + static_cast<int32_t>(size) : r);
+    }
+
+    inline float lerp(float a, float b, float t)
+    {
+        return a + (b - a) * t;
+    }
+}
+
+SampledTexture::SampledTexture(const uint8_t* rgba, uint32_t width, uint32_t height, bool generateMips)
+{
+    addMip(width, height);
+    for (uint32_t y = 0; y < height; y++)
+    {
+        for (uint32_t x = 0; x < width; x++)
+        {
+            uint32_t texel;
+            memcpy(&texel, rgba + (static_cast<size_t>(y) * width + x) * 4, sizeof(texel));
+            texels[mips[0].offset + tiledIndex(x, y, mips[0].tilesX)] = texel;
+        }
+    }
+
+    if (!generateMips)
+        return;
+
+    // Box filtered chain down to 1x1, the same sizes D3D12 uses for a full mip chain.
+    while (mips.back().width > 1 || mips.back().height > 1)
+    {
+        const uint32_t src = GetMipCount() - 1;
+        const uint32_t w = std::max(1u, mips[src].width / 2);
+        const uint32_t h = std::max(1u, mips[src].height / 2);
+        addMip(w, h);
+
+        const Mip& dst = mips.back();
+        for (uint32_t y = 0; y < h; y++)
+        {
+            const uint32_t y0 = std::min(2 * y, mips[src].height - 1);
+            const uint32_t y1 = std::min(2 * y + 1, mips[src].height - 1);
+            for (uint32_t x = 0; x < w; x++)
+            {
+                const uint32_t x0 = std::min(2 * x, mips[src].width - 1);
+                const uint32_t x1 = std::min(2 * x + 1, mips[src].width - 1);
+                const uint32_t t[4] = {
+                    fetch(src, x0, y0), fetch(src, x1, y0), fetch(src, x0, y1), fetch(src, x1, y1)
+                };
+
+                uint32_t texel = 0;
+                for (uint32_t c = 0; c < 32; c += 8)
+                {
+                    uint32_t sum = 2;
+                    for (uint32_t i = 0; i < 4; i++)
+                        sum += (t[i] >> c) & 0xFF;
+                    texel |= (sum / 4) << c;
+                }
+                texels[dst.offset + tiledIndex(x, y, dst.tilesX)] = texel;
+            }
+        }
+    }
+}
+
+uint32_t SampledTexture::tiledIndex(uint32_t x, uint32_t y, uint32_t tilesX)
+{
+    const uint32_t tile = (y / TileSize) * tilesX + x / TileSize;
+    return tile * TileTexels + (spread3(x & (TileSize - 1)) | (spread3(y & (TileSize - 1)) << 1));
+}
+
+void SampledTexture::addMip(uint32_t width, uint32_t height)
+{
+    Mip mip;
+    mip.width = width;
+    mip.height = height;
+    mip.tilesX = (width + TileSize - 1) / TileSize;
+    mip.offset = static_cast<uint32_t>(texels.size());
+
+    const uint32_t tilesY = (height + TileSize - 1) / TileSize;
+    texels.resize(texels.size() + static_cast<size_t>(mip.tilesX) * tilesY * TileTexels);
+    mips.push_back(mip);
+}
+
+uint32_t SampledTexture::fetch(uint32_t mip, uint32_t x, uint32_t y) const
+{
+    return texels[mips[mip].offset + tiledIndex(x, y, mips[mip].tilesX)];
+}
+
+float SampledTexture::computeLod(float dudx, float dvdx, float dudy, float dvdy) const
+{
+    const float w = static_cast<float>(GetWidth());
+    const float h = static_cast<float>(GetHeight());
+    const float lenX = (dudx * w) * (dudx * w) + (dvdx * h) * (dvdx * h);
+    const float lenY = (dudy * w) * (dudy * w) + (dvdy * h) * (dvdy * h);
+
+    // log2(sqrt(x)) == 0.5 * log2(x)
+    return 0.5f * std::log2(std::max(std::max(lenX, lenY), 1e-12f));
+}
+
+void SampledTexture::bilinearScalar(uint32_t mip, float u, float v, float* rgba) const
+{
+    const Mip& m = mips[mip];
+
+    const float fu = u * static_cast<float>(m.width) - 0.5f;
+    const float fv = v * static_cast<float>(m.height) - 0.5f;
+    const float x0f = std::floor(fu);
+    const float y0f = std::floor(fv);
+    const float a = fu - x0f;
+    const float b = fv - y0f;
+
+    const uint32_t x0 = wrapCoord(static_cast<int32_t>(x0f), m.width);
+    const uint32_t y0 = wrapCoord(static_cast<int32_t>(y0f), m.height);
+    const uint32_t x1 = x0 + 1 == m.width ? 0 : x0 + 1;
+    const uint32_t y1 = y0 + 1 == m.height ? 0 : y0 + 1;
+
+    const uint32_t t00 = fetch(mip, x0, y0);
+    const uint32_t t10 = fetch(mip, x1, y0);
+    const uint32_t t01 = fetch(mip, x0, y1);
+    const uint32_t t11 = fetch(mip, x1, y1);
+
+    for (uint32_t c = 0; c < 4; c++)
+    {
+        const uint32_t shift = c * 8;
+        const float top = lerp(static_cast<float>((t00 >> shift) & 0xFF), static_cast<float>((t10 >> shift) & 0xFF), a);
+        const float bottom = lerp(static_cast<float>((t01 >> shift) & 0xFF), static_cast<float>((t11 >> shift) & 0xFF), a);
+        rgba[c] = lerp(top, bottom, b) * (1.0f / 255.0f);
+    }
+}
+
+void SampledTexture::sampleScalar(float u, float v, float lod, float* rgba) const
+{
+    const float maxLod = static_cast<float>(GetMipCount() - 1);
+    lod = std::min(std::max(lod, 0.0f), maxLod);
+
+    const uint32_t l0 = static_cast<uint32_t>(lod);
+    const float f = lod - static_cast<float>(l0);
+    bilinearScalar(l0, u, v, rgba);
+    if (f <= 0.0f)
+        return;
+
+    float next[4];
+    bilinearScalar(std::min(l0 + 1, GetMipCount() - 1), u, v, next);
+    for (uint32_t c = 0; c < 4; c++)
+        rgba[c] = lerp(rgba[c], next[c], f);
+}
+
+#if defined(__AVX2__)
+namespace
+{
+    struct Rgba8
+    {
+        __m256 r, g, b, a;
+    };
+
+    inline __m256 channel(__m256i texel, int shift)
+    {
+        const __m256i mask = _mm256_set1_epi32(0xFF);
+        return _mm256_cvtepi32_ps(_mm256_and_si256(_mm256_srli_epi32(texel, shift), mask));
+    }
+
+    inline __m256 lerp8(__m256 a, __m256 b, __m256 t)
+    {
+        return _mm256_fmadd_ps(_mm256_sub_ps(b, a), t, a);
+    }
+
+    inline __m256i spread3x8(__m256i v)
+    {
+        const __m256i one = _mm256_set1_epi32(1);
+        const __m256i two = _mm256_set1_epi32(2);
+        const __m256i four = _mm256_set1_epi32(4);
+        return _mm256_or_si256(_mm256_and_si256(v, one),
+            _mm256_or_si256(_mm256_slli_epi32(_mm256_and_si256(v, two), 1),
+                _mm256_slli_epi32(_mm256_and_si256(v, four), 2)));
+    }
+
+    // floor(c) mod size for integral c, returned as int lanes in [0, size).
+    inline __m256i wrap8(__m256 c, __m256 size)
+    {
+        __m256 r = _mm256_sub_ps(c, _mm256_mul_ps(size, _mm256_floor_ps(_mm256_div_ps(c, size))));
+        r = _mm256_blendv_ps(r, _mm256_sub_ps(r, size), _mm256_cmp_ps(r, size, _CMP_GE_OQ));
+        r = _mm256_blendv_ps(r, _mm256_add_ps(r, size), _mm256_cmp_ps(r, _mm256_setzero_ps(), _CMP_LT_OQ));
+        return _mm256_cvttps_epi32(r);
+    }
+
+    inline __m256i next8(__m256i c, __m256i size)
+    {
+        const __m256i n = _mm256_add_epi32(c, _mm256_set1_epi32(1));
+        return _mm256_andnot_si256(_mm256_cmpeq_epi32(n, size), n);
+    }
+
+    inline __m256i tiled8(__m256i x, __m256i y, __m256i tilesX, __m256i offset)
+    {
+        const __m256i tile = _mm256_add_epi32(
+            _mm256_mullo_epi32(_mm256_srli_epi32(y, 3), tilesX), _mm256_srli_epi32(x, 3));
+        const __m256i seven = _mm256_set1_epi32(7);
+        const __m256i morton = _mm256_or_si256(
+            spread3x8(_mm256_and_si256(x, seven)),
+            _mm256_slli_epi32(spread3x8(_mm256_and_si256(y, seven)), 1));
+        return _mm256_add_epi32(offset, _mm256_add_epi32(_mm256_slli_epi32(tile, 6), morton));
+    }
+
+    Rgba8 bilinear8(const int* mipTable, const int* texels, __m256i mip, __m256 u, __m256 v)
+    {
+        const __m256i field = _mm256_slli_epi32(mip, 2);
+        const __m256i wi = _mm256_i32gather_epi32(mipTable, field, 4);
+        const __m256i hi = _mm256_i32gather_epi32(mipTable + 1, field, 4);
+        const __m256i tilesX = _mm256_i32gather_epi32(mipTable + 2, field, 4);
+        const __m256i offset = _mm256_i32gather_epi32(mipTable + 3, field, 4);
+        const __m256 w = _mm256_cvtepi32_ps(wi);
+        const __m256 h = _mm256_cvtepi32_ps(hi);
+
+        const __m256 half = _mm256_set1_ps(0.5f);
+        const __m256 fu = _mm256_fmsub_ps(u, w, half);
+        const __m256 fv = _mm256_fmsub_ps(v, h, half);
+        const __m256 x0f = _mm256_floor_ps(fu);
+        const __m256 y0f = _mm256_floor_ps(fv);
+        const __m256 a = _mm256_sub_ps(fu, x0f);
+        const __m256 b = _mm256_sub_ps(fv, y0f);
+
+        const __m256i x0 = wrap8(x0f, w);
+        const __m256i y0 = wrap8(y0f, h);
+        const __m256i x1 = next8(x0, wi);
+        const __m256i y1 = next8(y0, hi);
+
+        const __m256i t00 = _mm256_i32gather_epi32(texels, tiled8(x0, y0, tilesX, offset), 4);
+        const __m256i t10 = _mm256_i32gather_epi32(texels, tiled8(x1, y0, tilesX, offset), 4);
+        const __m256i t01 = _mm256_i32gather_epi32(texels, tiled8(x0, y1, tilesX, offset), 4);
+        const __m256i t11 = _mm256_i32gather_epi32(texels, tiled8(x1, y1, tilesX, offset), 4);
+
+        const __m256 scale = _mm256_set1_ps(1.0f / 255.0f);
+        __m256 out[4];
+        for (int c = 0; c < 4; c++)
+        {
+            const __m256 top = lerp8(channel(t00, c * 8), channel(t10, c * 8), a);
+            const __m256 bottom = lerp8(channel(t01, c * 8), channel(t11, c * 8), a);
+            out[c] = _mm256_mul_ps(lerp8(top, bottom, b), scale);
+        }
+        return { out[0], out[1], out[2], out[3] };
+    }
+}
+#endif
+
+void SampledTexture::sample(const float* u, const float* v, const float* lod, size_t count,
+    float* r, float* g, float* b, float* a) const
+{
+    size_t i = 0;
+
+#if defined(__AVX2__)
+    const int* mipTable = reinterpret_cast<const int*>(mips.data());
+    const int* texelData = reinterpret_cast<const int*>(texels.data());
+    const __m256 maxLod = _mm256_set1_ps(static_cast<float>(GetMipCount() - 1));
+    const __m256i maxMip = _mm256_set1_epi32(static_cast<int>(GetMipCount() - 1));
+
+    for (; i + 8 <= count; i += 8)
+    {
+        const __m256 uv = _mm256_loadu_ps(u + i);
+        const __m256 vv = _mm256_loadu_ps(v + i);
+        const __m256 l = _mm256_min_ps(_mm256_max_ps(_mm256_loadu_ps(lod + i), _mm256_setzero_ps()), maxLod);
+        const __m256 l0f = _mm256_floor_ps(l);
+        const __m256 f = _mm256_sub_ps(l, l0f);
+        const __m256i l0 = _mm256_cvttps_epi32(l0f);
+
+        Rgba8 c = bilinear8(mipTable, texelData, l0, uv, vv);
+
+        // Only pay for the second mip when some lane sits between two levels.
+        if (_mm256_movemask_ps(_mm256_cmp_ps(f, _mm256_setzero_ps(), _CMP_GT_OQ)) != 0)
+        {
+            const __m256i l1 = _mm256_min_epi32(_mm256_add_epi32(l0, _mm256_set1_epi32(1)), maxMip);
+            const Rgba8 n = bilinear8(mipTable, texelData, l1, uv, vv);
+            c.r = lerp8(c.r, n.r, f);
+            c.g = lerp8(c.g, n.g, f);
+            c.b = lerp8(c.b, n.b, f);
+            c.a = lerp8(c.a, n.a, f);
+        }
+
+        _mm256_storeu_ps(r + i, c.r);
+        _mm256_storeu_ps(g + i, c.g);
+        _mm256_storeu_ps(b + i, c.b);
+        _mm256_storeu_ps(a + i, c.a);
+    }
+#endif
+
+    for (; i < count; i++)
+    {
+        float rgba[4];
+        sampleScalar(u[i], v[i], lod[i], rgba);
+        r[i] = rgba[0];
+        g[i] = rgba[1];
+        b[i] = rgba[2];
+        a[i] = rgba[3];
+    }
+}
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// CPU counterpart of the LINEAR/WRAP static sampler from createRootSignature.
+// Texels are RGBA8 (DXGI_FORMAT_R8G8B8A8_UNORM) kept in 8x8 tiles, Morton
+// ordered inside a tile, so the four taps of a bilinear fetch usually land
+// in the same 256-byte block.
+class SampledTexture
+{
+public:
+    static const uint32_t TileSize = 8;
+    static const uint32_t TileTexels = TileSize * TileSize;
+
+    SampledTexture() = default;
+    SampledTexture(const uint8_t* rgba, uint32_t width, uint32_t height, bool generateMips = true);
+
+    uint32_t GetWidth(uint32_t mip = 0) const { return mips[mip].width; }
+    uint32_t GetHeight(uint32_t mip = 0) const { return mips[mip].height; }
+    uint32_t GetMipCount() const { return static_cast<uint32_t>(mips.size()); }
+
+    // Packed RGBA8 texel of the given mip, (x, y) already in range.
+    uint32_t fetch(uint32_t mip, uint32_t x, uint32_t y) const;
+
+    // LOD the hardware would pick for a pixel with the given UV derivatives.
+    float computeLod(float dudx, float dvdx, float dudy, float dvdy) const;
+
+    // Scalar reference of Texture2D::SampleLevel with MIN_MAG_MIP_LINEAR and
+    // WRAP addressing. Writes normalized RGBA to rgba[0..3].
+    void sampleScalar(float u, float v, float lod, float* rgba) const;
+
+    // Samples count pixels at once. Results are planar: r[i], g[i], b[i], a[i].
+    // Uses 8-wide gathers when built with AVX2, the scalar path otherwise.
+    void sample(const float* u, const float* v, const float* lod, size_t count,
+        float* r, float* g, float* b, float* a) const;
+
+private:
+    // Four 32-bit fields so the SIMD path can gather them per lane.
+    struct Mip
+    {
+        uint32_t width;
+        uint32_t height;
+        uint32_t tilesX;
+        uint32_t offset;
+    };
+
+    std::vector<Mip> mips;
+    std::vector<uint32_t> texels;
+
+    static uint32_t tiledIndex(uint32_t x, uint32_t y, uint32_t tilesX);
+
+    void addMip(uint32_t width, uint32_t height);
+    void bilinearScalar(uint32_t mip, float u, float v, float* rgba) const;
+};
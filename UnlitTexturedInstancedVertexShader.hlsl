@@ -0,0 +1,4 @@
+// The instanced variant of VertexShader.hlsl without lighting and with texturing, see the permutations there.
+#define TEXTURED
+#define INSTANCED
+#include "VertexShader.hlsl"
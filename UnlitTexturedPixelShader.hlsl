@@ -0,0 +1,3 @@
+// PixelShader.hlsl without lighting and with texturing, see the permutations there.
+#define TEXTURED
+#include "PixelShader.hlsl"
@@ -0,0 +1,3 @@
+// VertexShader.hlsl without lighting and with texturing, see the permutations there.
+#define TEXTURED
+#include "VertexShader.hlsl"
@@ -0,0 +1,3 @@
+// The instanced variant of VertexShader.hlsl without lighting and without texturing, see the permutations there.
+#define INSTANCED
+#include "VertexShader.hlsl"
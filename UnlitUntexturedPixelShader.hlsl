@@ -0,0 +1,2 @@
+// PixelShader.hlsl without lighting and without texturing, see the permutations there.
+#include "PixelShader.hlsl"
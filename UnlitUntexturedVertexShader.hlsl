@@ -0,0 +1,2 @@
+// VertexShader.hlsl without lighting and without texturing, see the permutations there.
+#include "VertexShader.hlsl"
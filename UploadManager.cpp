@@ -0,0 +1,36 @@
+#include "UploadManager.h"
+
+void UploadManager::init(size_t stagingCapacity)
+{
+    staging.init(stagingCapacity);
+    submittedValue = completedValue = 0;
+    openCopies = 0;
+    stats = Stats();
+}
+
+bool UploadManager::allocateStaging(size_t size, size_t alignment, size_t& offset)
+{
+    if (!staging.allocate(size, alignment, offset))
+        return false;
+
+    openCopies++;
+    stats.copies++;
+    stats.bytes += size;
+    return true;
+}
+
+uint64_t UploadManager::submitBatch()
+{
+    staging.finishFrame(++submittedValue);
+    openCopies = 0;
+    stats.batches++;
+    return submittedValue;
+}
+
+void UploadManager::retire(uint64_t completedFenceValue)
+{
+    if (completedFenceValue > completedValue)
+        completedValue = completedFenceValue;
+
+    staging.retire(completedValue);
+}
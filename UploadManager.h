@@ -0,0 +1,53 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "UploadRing.h"
+
+// Bookkeeping for filling DEFAULT heap resources from a copy queue. Data is
+// written into a staging ring and the backend records the copies into the
+// open batch; submitBatch() hands out the copy fence value the batch signals.
+// Staging memory is recycled once that value completes, and a resource is
+// ready to draw with when its batch's value has completed. Values only grow,
+// so one fence serves as a timeline for every upload. Not thread safe.
+class UploadManager
+{
+public:
+    struct Stats
+    {
+        uint64_t batches = 0;
+        uint64_t copies = 0;
+        uint64_t bytes = 0;
+    };
+
+    void init(size_t stagingCapacity);
+
+    // Returns false when staging is full. The caller submits the open batch
+    // if there is one, otherwise waits for getOldestFenceValue() and calls
+    // retire() before trying again.
+    bool allocateStaging(size_t size, size_t alignment, size_t& offset);
+
+    // Fence value of the open batch; copies recorded now are done once the
+    // copy fence reaches it.
+    uint64_t getBatchFenceValue() const { return submittedValue + 1; }
+    bool hasOpenBatch() const { return openCopies != 0; }
+    uint64_t submitBatch();
+
+    void retire(uint64_t completedFenceValue);
+    bool isComplete(uint64_t fenceValue) const { return fenceValue <= completedValue; }
+
+    bool hasPendingBatches() const { return staging.hasPendingFrames(); }
+    uint64_t getOldestFenceValue() const { return staging.getOldestFenceValue(); }
+    uint64_t getSubmittedFenceValue() const { return submittedValue; }
+
+    const UploadRing& getStaging() const { return staging; }
+    const Stats& getStats() const { return stats; }
+
+private:
+    UploadRing staging;
+    uint64_t submittedValue = 0;
+    uint64_t completedValue = 0;
+    uint32_t openCopies = 0;
+    Stats stats;
+};
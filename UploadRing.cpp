@@ -0,0 +1,78 @@
+#include "UploadRing.h"
+
+#include <algorithm>
+
+void UploadRing::init(size_t capacity)
+{
+    this->capacity = capacity;
+    head = tail = used = peakUsed = 0;
+    allocatedTotal = retiredTotal = 0;
+    frames.clear();
+}
+
+bool UploadRing::allocate(size_t size, size_t alignment, size_t& offset)
+{
+    if (size > capacity || used == capacity)
+        return false;
+
+    // Nothing in flight, start over at the beginning for the largest run.
+    if (used == 0)
+        head = tail = 0;
+
+    size_t start = (head + alignment - 1) & ~(alignment - 1);
+    size_t consumed;
+
+    if (head >= tail)
+    {
+        // Free space is [head, capacity) and [0, tail).
+        if (start + size <= capacity)
+        {
+            consumed = start + size - head;
+        }
+        else
+        {
+            // Skip the end of the buffer, the skipped bytes go out with this frame.
+            if (size > tail)
+                return false;
+            start = 0;
+            consumed = capacity - head + size;
+        }
+    }
+    else
+    {
+        // Free space is [head, tail).
+        if (start + size > tail)
+            return false;
+        consumed = start + size - head;
+    }
+
+    head = start + size;
+    used += consumed;
+    allocatedTotal += consumed;
+    peakUsed = std::max(peakUsed, used);
+
+    offset = start;
+    return true;
+}
+
+void UploadRing::finishFrame(uint64_t fenceValue)
+{
+    frames.push_back({ fenceValue, head, allocatedTotal });
+}
+
+void UploadRing::retire(uint64_t completedFenceValue)
+{
+    while (!frames.empty() && frames.front().fenceValue <= completedFenceValue)
+    {
+        // Frames that got nothing may predate the reset in allocate(), their
+        // head is stale.
+        const FrameMarker& frame = frames.front();
+        if (frame.allocatedTotal != retiredTotal)
+        {
+            used -= static_cast<size_t>(frame.allocatedTotal - retiredTotal);
+            retiredTotal = frame.allocatedTotal;
+            tail = frame.head;
+        }
+        frames.pop_front();
+    }
+}
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+
+// Linear allocator over one persistently mapped upload buffer, used as a ring.
+// Allocations made between two finishFrame() calls belong to that frame and
+// are released together once the fence value passed for the frame completes.
+// Only works with offsets, so the same logic serves every backend. Not thread
+// safe.
+class UploadRing
+{
+public:
+    void init(size_t capacity);
+
+    // Returns false when the ring is full; the caller can wait for
+    // getOldestFenceValue(), retire() and try again.
+    bool allocate(size_t size, size_t alignment, size_t& offset);
+
+    void finishFrame(uint64_t fenceValue);
+    void retire(uint64_t completedFenceValue);
+
+    bool hasPendingFrames() const { return !frames.empty(); }
+    uint64_t getOldestFenceValue() const { return frames.front().fenceValue; }
+
+    size_t getCapacity() const { return capacity; }
+    size_t getUsedSize() const { return used; }
+    size_t getPeakUsedSize() const { return peakUsed; }
+
+private:
+    struct FrameMarker
+    {
+        uint64_t fenceValue;
+        size_t head;
+        uint64_t allocatedTotal;
+    };
+
+    size_t capacity = 0;
+    size_t head = 0;
+    size_t tail = 0;
+    size_t used = 0;
+    size_t peakUsed = 0;
+
+    // Bytes handed out so far, padding included; frames remember it so
+    // retiring knows how much they held.
+    uint64_t allocatedTotal = 0;
+    uint64_t retiredTotal = 0;
+
+    std::deque<FrameMarker> frames;
+};
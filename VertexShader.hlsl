@@ -1,36 +1,109 @@
-cbuffer vs_const_buffer_t {
-	float4x4 matWorldViewProj;
-	float4x4 matWorldView;
+// Compiled once per permutation, see the *VertexShader.hlsl wrappers: LIT
+// applies the directional light and passes on what the pixel shader needs for
+// shadows, TEXTURED passes on texture coordinates, INSTANCED reads the
+// per-instance stream instead of the object table. Features left out cost
+// neither branches nor attribute fetches.
+
+cbuffer vs_const_buffer_t : register(b0) {
+	float4x4 matViewProj;
 	float4x4 matView;
 
 	float4 colLight;
 	float4 dirLight;
 
-	float4 padding[2];
+	float4x4 matShadow[4];
+	float4 cascadeSplits;
+	float4 shadowParams;
+
+	float4 padding[4];
+};
+
+cbuffer draw_constants_t : register(b1) {
+	uint materialId;
+	uint objectId;
+};
+
+struct material_t {
+	float4 color;
+	uint textureIndex;
+	uint3 padding;
+};
+
+struct object_t {
+	float4x4 matWorld;
 };
 
+StructuredBuffer<material_t> materials : register(t0);
+StructuredBuffer<object_t> objects : register(t1);
+
 struct vs_output_t {
 	float4 position : SV_POSITION;
 	float4 color : COLOR;
+#ifdef TEXTURED
 	float2 tex : TEXCOORD;
+#endif
+#ifdef LIT
+	float3 worldPos : WORLDPOS;
+	float viewDepth : VIEWDEPTH;
+	// 1 where the light was applied, so shadows can take it away.
+	float shadowed : SHADOWED;
+#endif
+};
+
+#ifdef INSTANCED
+// Per-instance stream: the world matrix's first three columns, a tint and a
+// lit flag.
+struct instance_t {
+	float4 world0 : WORLD0;
+	float4 world1 : WORLD1;
+	float4 world2 : WORLD2;
+	float4 tint : TINT;
+	uint lit : INSTANCELIT;
 };
+#endif
 
-vs_output_t main(float3 pos : POSITION, float3 norm : NORMAL, float4 col : COLOR, float2 tex : TEXCOORD, uint is_no_light : BLENDINDICES) {
+vs_output_t main(float3 pos : POSITION, float4 col : COLOR
+#ifdef LIT
+	, float3 norm : NORMAL
+#endif
+#ifdef TEXTURED
+	, float2 tex : TEXCOORD
+#endif
+#ifdef INSTANCED
+	, instance_t instance
+#endif
+) {
 	vs_output_t result;
 
-	float4 NW = mul(float4(norm, 0.0f), matWorldView);
-	float4 LW = mul(dirLight, matView);
-
-	result.position = mul(float4(pos, 1.0f), matWorldViewProj);
-	if (is_no_light == 0)
-	{
-		result.color = mul(max(-dot(normalize(LW), normalize(NW)), 0.0f), colLight * col);
-	}
-	else
-	{
-		result.color = col;
-	}
+#ifdef INSTANCED
+	float4x4 matWorld = transpose(float4x4(instance.world0, instance.world1, instance.world2, float4(0.0f, 0.0f, 0.0f, 1.0f)));
+	float4 tint = instance.tint;
+	uint lit = instance.lit;
+#else
+	float4x4 matWorld = objects[objectId].matWorld;
+	float4 tint = float4(1.0f, 1.0f, 1.0f, 1.0f);
+	uint lit = 1;
+#endif
+
+	float4 worldPos = mul(float4(pos, 1.0f), matWorld);
+	result.position = mul(worldPos, matViewProj);
+	result.color = col * materials[materialId].color * tint;
+
+#ifdef LIT
+	float4 NW = mul(mul(float4(norm, 0.0f), matWorld), matView);
+	float4 LW = dirLight;
+
+	result.worldPos = worldPos.xyz;
+	result.viewDepth = mul(worldPos, matView).z;
+	// Only instances can opt out of the light, per instance rather than per
+	// vertex.
+	result.shadowed = lit != 0 ? 1.0f : 0.0f;
+	if (lit != 0)
+		result.color *= max(-dot(normalize(LW), normalize(NW)), 0.0f) * colLight;
+#endif
+#ifdef TEXTURED
 	result.tex = tex;
+#endif
 
 	return result;
 }
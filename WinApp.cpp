@@ -1,10 +1,13 @@
 #include "stdafx.h"
 #include "WinApp.h"
+#include "CpuProfiler.h"
 
 HWND WinApp::hwnd = nullptr;
 
 int WinApp::Run(D3DApp* dApp, HINSTANCE hInstance, int nCmdShow)
 {
+    PROFILE_THREAD("Main");
+
     // Initialize the window class.
     WNDCLASSEX windowClass = { 0 };
     windowClass.cbSize = sizeof(WNDCLASSEX);
@@ -33,6 +36,14 @@ int WinApp::Run(D3DApp* dApp, HINSTANCE hInstance, int nCmdShow)
         hInstance,
         dApp);
 
+    // Raw mouse movement for mouse look, without pointer acceleration and
+    // not stopped by the edges of the screen.
+    RAWINPUTDEVICE mouse = {};
+    mouse.usUsagePage = 0x01;
+    mouse.usUsage = 0x02;
+    mouse.hwndTarget = hwnd;
+    RegisterRawInputDevices(&mouse, 1, sizeof(mouse));
+
     // Initialize the sample. OnInit is defined in each child-implementation of DXSample.
     dApp->init();
 
@@ -79,6 +90,51 @@ LRESULT CALLBACK WinApp::WindowProc(HWND hWnd, UINT message, WPARAM wParam, LPAR
         }
         return 0;
 
+    case WM_SIZE:
+        if (dApp && wParam != SIZE_MINIMIZED)
+            dApp->resize();
+        return 0;
+
+    case WM_KEYDOWN:
+    case WM_SYSKEYDOWN:
+        // Held keys repeat the message; only the first one is an event.
+        if (dApp && !(lParam & (1 << 30)))
+            dApp->onInput({ InputEventType::KeyDown, static_cast<uint32_t>(wParam) });
+        if (message == WM_KEYDOWN)
+            return 0;
+        break;
+
+    case WM_KEYUP:
+    case WM_SYSKEYUP:
+        if (dApp)
+            dApp->onInput({ InputEventType::KeyUp, static_cast<uint32_t>(wParam) });
+        if (message == WM_KEYUP)
+            return 0;
+        break;
+
+    case WM_INPUT:
+        if (dApp)
+        {
+            RAWINPUT raw;
+            UINT size = sizeof(raw);
+            if (GetRawInputData(reinterpret_cast<HRAWINPUT>(lParam), RID_INPUT, &raw, &size, sizeof(RAWINPUTHEADER)) != UINT(-1)
+                && raw.header.dwType == RIM_TYPEMOUSE && !(raw.data.mouse.usFlags & MOUSE_MOVE_ABSOLUTE))
+            {
+                InputEvent event = { InputEventType::MouseMove };
+                event.dx = raw.data.mouse.lLastX;
+                event.dy = raw.data.mouse.lLastY;
+                dApp->onInput(event);
+            }
+        }
+        // DefWindowProc cleans up after the message.
+        break;
+
+    case WM_KILLFOCUS:
+        // The key ups go to the window that gets the focus.
+        if (dApp)
+            dApp->onInput({ InputEventType::ReleaseAll });
+        return 0;
+
     case WM_DESTROY:
         PostQuitMessage(0);
         return 0;
@@ -0,0 +1,101 @@
+#include "WorkerPool.h"
+
+#include "CpuProfiler.h"
+
+WorkerPool::WorkerPool(uint32_t threadCount)
+{
+    for (uint32_t i = 1; i < threadCount; i++)
+        threads.emplace_back(&WorkerPool::workerLoop, this);
+}
+
+WorkerPool::~WorkerPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    wakeCondition.notify_all();
+
+    for (std::thread& thread : threads)
+        thread.join();
+}
+
+void WorkerPool::run(uint32_t count, const std::function<void(uint32_t)>& task)
+{
+    if (count == 0)
+        return;
+
+    if (threads.empty() || count == 1)
+    {
+        for (uint32_t i = 0; i < count; i++)
+            task(i);
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        currentTask = &task;
+        taskCount = count;
+        nextTask = 0;
+        finishedTasks = 0;
+        generation++;
+    }
+    wakeCondition.notify_all();
+
+    const uint32_t finished = runTasks(task, count);
+
+    // Workers that woke up late may still be looking at this run, so wait for
+    // them to leave as well before the task goes out of scope.
+    std::unique_lock<std::mutex> lock(mutex);
+    finishedTasks += finished;
+    doneCondition.wait(lock, [this] { return finishedTasks == taskCount && activeWorkers == 0; });
+    currentTask = nullptr;
+    taskCount = 0;
+}
+
+void WorkerPool::workerLoop()
+{
+    PROFILE_THREAD("Worker");
+    uint64_t seenGeneration = 0;
+
+    for (;;)
+    {
+        const std::function<void(uint32_t)>* task;
+        uint32_t count;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            wakeCondition.wait(lock, [&] { return stopping || generation != seenGeneration; });
+            if (stopping)
+                return;
+
+            seenGeneration = generation;
+            if (!currentTask)
+                continue;
+
+            task = currentTask;
+            count = taskCount;
+            activeWorkers++;
+        }
+
+        const uint32_t finished = runTasks(*task, count);
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            finishedTasks += finished;
+            activeWorkers--;
+        }
+        doneCondition.notify_one();
+    }
+}
+
+uint32_t WorkerPool::runTasks(const std::function<void(uint32_t)>& task, uint32_t count)
+{
+    uint32_t finished = 0;
+    for (uint32_t i = nextTask++; i < count; i = nextTask++)
+    {
+        PROFILE_ZONE("WorkerTask");
+        task(i);
+        finished++;
+    }
+    return finished;
+}
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Fixed set of threads for fork-join work inside a frame. run() hands out task
+// indices to the workers and to the calling thread, and returns once every
+// task has finished.
+class WorkerPool
+{
+public:
+    // threadCount includes the calling thread, so 1 means no extra threads.
+    explicit WorkerPool(uint32_t threadCount);
+    ~WorkerPool();
+
+    WorkerPool(const WorkerPool&) = delete;
+    WorkerPool& operator=(const WorkerPool&) = delete;
+
+    uint32_t getThreadCount() const { return static_cast<uint32_t>(threads.size()) + 1; }
+
+    void run(uint32_t taskCount, const std::function<void(uint32_t)>& task);
+
+private:
+    std::vector<std::thread> threads;
+
+    std::mutex mutex;
+    std::condition_variable wakeCondition;
+    std::condition_variable doneCondition;
+
+    const std::function<void(uint32_t)>* currentTask = nullptr;
+    uint32_t taskCount = 0;
+    std::atomic<uint32_t> nextTask = 0;
+    uint32_t finishedTasks = 0;
+    uint32_t activeWorkers = 0;
+    uint64_t generation = 0;
+    bool stopping = false;
+
+    void workerLoop();
+    uint32_t runTasks(const std::function<void(uint32_t)>& task, uint32_t count);
+};
@@ -0,0 +1,17 @@
+#pragma once
+
+#include <cstdio>
+
+// Minimal checks for the headless tests: a failed CHECK is reported and
+// makes main() return 1 through checkFailures, but the test goes on.
+inline int checkFailures = 0;
+
+#define CHECK(condition) \
+    do \
+    { \
+        if (!(condition)) \
+        { \
+            std::printf("%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #condition); \
+            checkFailures++; \
+        } \
+    } while (false)
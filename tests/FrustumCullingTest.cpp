@@ -0,0 +1,266 @@
+#include "../FrustumCulling.h"
+#include "Check.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <iterator>
+#include <random>
+#include <vector>
+
+namespace
+{
+    const XMFLOAT3 Origin(0.0f, 0.0f, 0.0f);
+    const XMFLOAT3 CameraPosition(-1.0f, 2.0f, -5.0f);
+
+    float planeDistance(const XMFLOAT4& plane, const XMFLOAT3& point)
+    {
+        return plane.x * point.x + plane.y * point.y + plane.z * point.z + plane.w;
+    }
+
+    // The camera is turned by 0.3 rad, so no plane lines up with an axis.
+    Frustum cameraFrustum()
+    {
+        const XMMATRIX view = XMMatrixTranslation(-CameraPosition.x, -CameraPosition.y, -CameraPosition.z)
+            * XMMatrixRotationY(0.3f);
+        return extractFrustum(view * XMMatrixPerspectiveFovLH(XM_PIDIV4, 16.0f / 9.0f, 0.1f, 100.0f));
+    }
+
+    // The world origin is inside this one, so the zeroed padding lanes would
+    // pass the plane tests if the kernel did not mask them off.
+    Frustum originFrustum()
+    {
+        return extractFrustum(XMMatrixTranslation(0.0f, 0.0f, 10.0f)
+            * XMMatrixPerspectiveFovLH(XM_PIDIV2, 1.0f, 0.1f, 100.0f));
+    }
+
+    // How far the object reaches past the plane it is furthest behind;
+    // negative when it is culled.
+    float margin(const CullingBounds& bounds, const Frustum& frustum, size_t i)
+    {
+        float result = INFINITY;
+        for (const XMFLOAT4& plane : frustum.planes)
+        {
+            const float distance = planeDistance(plane,
+                XMFLOAT3(bounds.getCenterX()[i], bounds.getCenterY()[i], bounds.getCenterZ()[i]));
+            const float reach = std::min(bounds.getRadius()[i], std::fabs(plane.x) * bounds.getExtentX()[i]
+                + std::fabs(plane.y) * bounds.getExtentY()[i] + std::fabs(plane.z) * bounds.getExtentZ()[i]);
+            result = std::min(result, distance + reach);
+        }
+        return result;
+    }
+
+    // Objects of random size, rotation and scale spread around the frustum.
+    CullingBounds randomBounds(std::mt19937& random, size_t count)
+    {
+        std::uniform_real_distribution<float> position(-80.0f, 80.0f);
+        std::uniform_real_distribution<float> size(0.1f, 4.0f);
+        std::uniform_real_distribution<float> angle(0.0f, XM_2PI);
+
+        CullingBounds bounds;
+        bounds.reserve(count);
+        for (size_t i = 0; i < count; i++)
+        {
+            const XMFLOAT3 center(size(random) - 2.0f, 0.0f, 0.0f);
+            const XMFLOAT3 extents(size(random), size(random), size(random));
+            const float radius = std::sqrt(extents.x * extents.x + extents.y * extents.y + extents.z * extents.z)
+                * (i % 2 ? 1.0f : 0.6f);
+            const XMMATRIX world = XMMatrixScaling(size(random), size(random), size(random))
+                * XMMatrixRotationY(angle(random)) * XMMatrixTranslation(position(random), position(random), position(random));
+            bounds.add(center, extents, radius, world);
+        }
+        return bounds;
+    }
+
+    // SIMD and scalar results have to match, except where rounding differs
+    // right at a plane.
+    void checkParity(const CullingBounds& bounds, const Frustum& frustum)
+    {
+        // cullBounds() appends, so the list starts with a sentinel.
+        std::vector<uint32_t> simd = { UINT32_MAX };
+        std::vector<uint32_t> scalar;
+        cullBounds(bounds, frustum, simd);
+        cullBoundsScalar(bounds, frustum, scalar);
+
+        CHECK(!simd.empty() && simd[0] == UINT32_MAX);
+        simd.erase(simd.begin());
+        CHECK(std::is_sorted(simd.begin(), simd.end()));
+        CHECK(simd.empty() || simd.back() < bounds.size());
+
+        std::vector<uint32_t> difference;
+        std::set_symmetric_difference(simd.begin(), simd.end(), scalar.begin(), scalar.end(), std::back_inserter(difference));
+        for (uint32_t i : difference)
+            CHECK(std::fabs(margin(bounds, frustum, i)) < 1e-3f);
+    }
+
+    void testExtractFrustum()
+    {
+        const Frustum frustum = originFrustum();
+        for (const XMFLOAT4& plane : frustum.planes)
+        {
+            CHECK(std::fabs(plane.x * plane.x + plane.y * plane.y + plane.z * plane.z - 1.0f) < 1e-5f);
+            CHECK(planeDistance(plane, Origin) > 0.0f);
+        }
+
+        // Left, right, bottom, top, near, far.
+        CHECK(planeDistance(frustum.planes[0], XMFLOAT3(-20.0f, 0.0f, 0.0f)) < 0.0f);
+        CHECK(planeDistance(frustum.planes[1], XMFLOAT3(20.0f, 0.0f, 0.0f)) < 0.0f);
+        CHECK(planeDistance(frustum.planes[2], XMFLOAT3(0.0f, -20.0f, 0.0f)) < 0.0f);
+        CHECK(planeDistance(frustum.planes[3], XMFLOAT3(0.0f, 20.0f, 0.0f)) < 0.0f);
+        CHECK(std::fabs(planeDistance(frustum.planes[4], XMFLOAT3(0.0f, 0.0f, -9.9f))) < 1e-4f);
+        CHECK(std::fabs(planeDistance(frustum.planes[5], XMFLOAT3(0.0f, 0.0f, 90.0f))) < 1e-3f);
+    }
+
+    // Objects on both sides of each plane, close enough to cross it or not.
+    void testStraddling()
+    {
+        const Frustum frustum = cameraFrustum();
+
+        // A point halfway down the view axis, which the near plane faces
+        // along. Its projection onto any one plane stays inside the other
+        // five, even onto the near plane.
+        const XMFLOAT4& forward = frustum.planes[4];
+        const XMFLOAT3 inside(CameraPosition.x + forward.x * 50.0f, CameraPosition.y + forward.y * 50.0f,
+            CameraPosition.z + forward.z * 50.0f);
+        for (const XMFLOAT4& plane : frustum.planes)
+            CHECK(planeDistance(plane, inside) > 5.0f);
+
+        // Unit cubes reach 0.5 to 0.87 across a plane, spheres of radius 1
+        // inside a 2x2x2 box reach 1.
+        struct Case
+        {
+            float offset;
+            XMFLOAT3 extents;
+            float radius;
+            bool visible;
+        };
+        const Case cases[] = {
+            { 0.25f, XMFLOAT3(0.5f, 0.5f, 0.5f), 0.87f, true },
+            { -0.25f, XMFLOAT3(0.5f, 0.5f, 0.5f), 0.87f, true },
+            { -1.0f, XMFLOAT3(0.5f, 0.5f, 0.5f), 0.87f, false },
+            { -0.9f, XMFLOAT3(1.0f, 1.0f, 1.0f), 1.0f, true },
+            { -1.1f, XMFLOAT3(1.0f, 1.0f, 1.0f), 1.0f, false },
+        };
+
+        CullingBounds bounds;
+        std::vector<uint32_t> expected;
+        for (const XMFLOAT4& plane : frustum.planes)
+        {
+            const float distance = planeDistance(plane, inside);
+            for (const Case& c : cases)
+            {
+                const float along = c.offset - distance;
+                const XMMATRIX world = XMMatrixTranslation(
+                    inside.x + plane.x * along, inside.y + plane.y * along, inside.z + plane.z * along);
+                if (c.visible)
+                    expected.push_back(static_cast<uint32_t>(bounds.size()));
+                bounds.add(Origin, c.extents, c.radius, world);
+            }
+        }
+
+        // 30 objects, so the last group of 8 is partly padding.
+        std::vector<uint32_t> simd, scalar;
+        cullBounds(bounds, frustum, simd);
+        cullBoundsScalar(bounds, frustum, scalar);
+        CHECK(simd == expected);
+        CHECK(scalar == expected);
+    }
+
+    void testTail()
+    {
+        std::mt19937 random(1);
+        const Frustum frustum = originFrustum();
+
+        // Everything at the origin is visible; only the padding is not.
+        for (size_t count = 0; count <= 33; count++)
+        {
+            CullingBounds bounds;
+            for (size_t i = 0; i < count; i++)
+                bounds.add(Origin, XMFLOAT3(1.0f, 1.0f, 1.0f), 1.0f, XMMatrixIdentity());
+
+            std::vector<uint32_t> visible;
+            cullBounds(bounds, frustum, visible);
+            CHECK(visible.size() == count);
+            for (size_t i = 0; i < visible.size(); i++)
+                CHECK(visible[i] == i);
+        }
+
+        for (size_t count : { 0, 1, 7, 8, 9, 15, 16, 17, 1000, 4097 })
+        {
+            checkParity(randomBounds(random, count), frustum);
+            checkParity(randomBounds(random, count), cameraFrustum());
+        }
+    }
+
+    void testSetAndClear()
+    {
+        const Frustum frustum = originFrustum();
+        CullingBounds bounds;
+        for (int i = 0; i < 10; i++)
+            bounds.add(Origin, XMFLOAT3(1.0f, 1.0f, 1.0f), 1.0f, XMMatrixIdentity());
+
+        // Moving an object behind the camera culls it; scaling one up lets
+        // it reach back in.
+        bounds.set(3, Origin, XMFLOAT3(1.0f, 1.0f, 1.0f), 1.0f, XMMatrixTranslation(0.0f, 0.0f, -50.0f));
+        bounds.set(4, Origin, XMFLOAT3(1.0f, 1.0f, 1.0f), 1.0f,
+            XMMatrixScaling(45.0f, 45.0f, 45.0f) * XMMatrixTranslation(0.0f, 0.0f, -50.0f));
+        std::vector<uint32_t> visible;
+        cullBounds(bounds, frustum, visible);
+        CHECK(visible.size() == 9 && std::find(visible.begin(), visible.end(), 3u) == visible.end());
+
+        bounds.clear();
+        CHECK(bounds.size() == 0);
+        visible.clear();
+        cullBounds(bounds, frustum, visible);
+        CHECK(visible.empty());
+    }
+
+    void benchmark()
+    {
+        std::mt19937 random(2);
+        const size_t count = 100000;
+        const CullingBounds bounds = randomBounds(random, count);
+        const Frustum frustum = cameraFrustum();
+
+        std::vector<uint32_t> visible;
+        visible.reserve(count + CullingBounds::Width);
+        const int runs = 200;
+
+        auto time = [&](void (*cull)(const CullingBounds&, const Frustum&, std::vector<uint32_t>&))
+        {
+            visible.clear();
+            cull(bounds, frustum, visible);
+            const auto start = std::chrono::steady_clock::now();
+            for (int run = 0; run < runs; run++)
+            {
+                visible.clear();
+                cull(bounds, frustum, visible);
+            }
+            return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / runs;
+        };
+
+        const double simdMs = time(cullBounds);
+        const size_t simdVisible = visible.size();
+        const double scalarMs = time(cullBoundsScalar);
+        std::printf("100k objects, %zu visible: cullBounds %.3f ms, cullBoundsScalar %.3f ms\n",
+            simdVisible, simdMs, scalarMs);
+    }
+}
+
+int main()
+{
+    testExtractFrustum();
+    testStraddling();
+    testTail();
+    testSetAndClear();
+    benchmark();
+
+    if (checkFailures)
+    {
+        std::printf("FrustumCullingTest: %d failed\n", checkFailures);
+        return 1;
+    }
+    std::printf("FrustumCullingTest: passed\n");
+    return 0;
+}
@@ -0,0 +1,340 @@
+#include "../GpuMemoryPool.h"
+#include "../HeapAllocator.h"
+#include "Check.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <map>
+#include <random>
+#include <vector>
+
+namespace
+{
+    const uint64_t KB = 1024;
+    const uint64_t MB = 1024 * KB;
+
+    void testExactFit()
+    {
+        // A request as large as the whole heap takes all of it.
+        HeapAllocator heap(MB);
+        HeapAllocator::Allocation all = heap.allocate(MB, 64 * KB);
+        CHECK(all.isValid() && all.offset == 0 && all.size == MB);
+        CHECK(!heap.allocate(1, 1).isValid());
+        if (all.isValid())
+            heap.free(all.block);
+
+        // Sizes close to the top of a size class, where rounding up to the
+        // next list would miss the one block that fits.
+        const uint64_t sizes[] = { 33 * 256, 63 * 256, 1000 * 256, 40 * MB - 256 };
+        for (uint64_t size : sizes)
+        {
+            HeapAllocator exact(size);
+            HeapAllocator::Allocation allocation = exact.allocate(size, 256);
+            CHECK(allocation.isValid() && allocation.size == size);
+        }
+
+        // The same for a free block between two allocations.
+        HeapAllocator::Allocation first = heap.allocate(64 * KB, 256);
+        HeapAllocator::Allocation middle = heap.allocate(300 * KB, 256);
+        HeapAllocator::Allocation last = heap.allocate(MB - 364 * KB, 256);
+        CHECK(first.isValid() && middle.isValid() && last.isValid());
+        if (middle.isValid())
+            heap.free(middle.block);
+        HeapAllocator::Allocation again = heap.allocate(300 * KB, 256);
+        CHECK(again.isValid() && again.offset == middle.offset);
+    }
+
+    void testExactFitPages()
+    {
+        // Requests larger than a page get a page of exactly their size.
+        GpuMemoryPool pool(4 * MB);
+        GpuMemoryPool::Allocation large = pool.allocate(9 * MB + 1, 64 * KB, 1);
+        CHECK(large.isValid() && large.offset == 0);
+        CHECK(large.isValid() && pool.getPageSize(large.page) == 9 * MB + 64 * KB);
+
+        GpuMemoryPool::Allocation page = pool.allocate(4 * MB, 64 * KB, 2);
+        CHECK(page.isValid() && page.offset == 0);
+        CHECK(pool.getStats().pageCount == 2);
+    }
+
+    void testAlignment()
+    {
+        HeapAllocator heap(16 * MB);
+        HeapAllocator::Allocation small = heap.allocate(1, 1);
+        CHECK(small.isValid() && small.offset == 0 && small.size == HeapAllocator::MinBlockSize);
+
+        // The padding in front of the aligned offset stays free and is used
+        // by the next request that fits in it.
+        HeapAllocator::Allocation aligned = heap.allocate(4 * MB, 4 * MB);
+        CHECK(aligned.isValid() && aligned.offset == 4 * MB && aligned.alignment == 4 * MB);
+        HeapAllocator::Allocation padding = heap.allocate(MB, 64 * KB);
+        CHECK(padding.isValid() && padding.offset == 64 * KB);
+        CHECK(heap.getUsedSize() == small.size + aligned.size + padding.size);
+
+        for (uint64_t alignment = 1; alignment <= 8 * MB; alignment *= 2)
+        {
+            HeapAllocator::Allocation allocation = heap.allocate(1000, alignment);
+            if (allocation.isValid())
+                CHECK(allocation.offset % alignment == 0 && allocation.alignment == std::max(alignment, HeapAllocator::MinBlockSize));
+        }
+    }
+
+    void testSplitMerge()
+    {
+        HeapAllocator heap(MB);
+        std::vector<HeapAllocator::Allocation> allocations;
+        for (int i = 0; i < 4; i++)
+            allocations.push_back(heap.allocate(256 * KB, 256));
+        CHECK(heap.getStats().freeBlockCount == 0);
+
+        // Freeing the 2nd and 4th leaves two free blocks; freeing the 3rd
+        // merges it with both neighbours.
+        heap.free(allocations[1].block);
+        heap.free(allocations[3].block);
+        CHECK(heap.getStats().freeBlockCount == 2);
+        heap.free(allocations[2].block);
+        HeapAllocator::Stats stats = heap.getStats();
+        CHECK(stats.freeBlockCount == 1 && stats.largestFreeBlock == 768 * KB);
+
+        heap.free(allocations[0].block);
+        stats = heap.getStats();
+        CHECK(heap.isEmpty() && stats.freeBlockCount == 1 && stats.largestFreeBlock == MB && stats.usedSize == 0);
+    }
+
+    void testReuse()
+    {
+        HeapAllocator heap(MB);
+        HeapAllocator::Allocation a = heap.allocate(64 * KB, 256, 1);
+        HeapAllocator::Allocation b = heap.allocate(64 * KB, 256, 2);
+        heap.allocate(64 * KB, 256, 3);
+
+        // The freed block is found again in its list, and owners follow the
+        // blocks.
+        heap.free(b.block);
+        HeapAllocator::Allocation c = heap.allocate(64 * KB, 256, 4);
+        CHECK(c.offset == b.offset);
+
+        uint32_t owners = 0;
+        heap.forEachAllocation([&](const HeapAllocator::Allocation& allocation, uint64_t owner)
+        {
+            CHECK((allocation.offset == a.offset) == (owner == 1));
+            CHECK((allocation.offset == c.offset) == (owner == 4));
+            owners++;
+        });
+        CHECK(owners == 3);
+
+        // Freed block records are reused, so churn does not grow them.
+        for (int i = 0; i < 1000; i++)
+        {
+            HeapAllocator::Allocation x = heap.allocate(256 * (1 + i % 100), 256);
+            HeapAllocator::Allocation y = heap.allocate(256 * (1 + i % 37), 4 * KB);
+            CHECK(x.isValid() && y.isValid());
+            CHECK(x.block < 16 && y.block < 16);
+            heap.free(x.block);
+            heap.free(y.block);
+        }
+        CHECK(heap.getStats().freeBlockCount == 1);
+    }
+
+    // Random allocations and frees checked against a map of live ranges.
+    void testRandom()
+    {
+        std::mt19937_64 random(7);
+        for (int trial = 0; trial < 50; trial++)
+        {
+            const uint64_t size = (1 + random() % 64) * MB;
+            HeapAllocator heap(size);
+            std::map<uint64_t, HeapAllocator::Allocation> live;
+            uint64_t usedSize = 0;
+
+            for (int step = 0; step < 4000; step++)
+            {
+                if (random() % 3 == 0 && !live.empty())
+                {
+                    auto it = live.begin();
+                    std::advance(it, random() % live.size());
+                    heap.free(it->second.block);
+                    usedSize -= it->second.size;
+                    live.erase(it);
+                    continue;
+                }
+
+                const uint64_t request = 1 + random() % (random() % 4 ? 70000 : 2000000);
+                const uint64_t alignment = 256ull << (random() % 9);
+                HeapAllocator::Allocation allocation = heap.allocate(request, alignment);
+                if (!allocation.isValid())
+                    continue;
+
+                CHECK(allocation.offset % alignment == 0);
+                CHECK(allocation.size >= request && allocation.offset + allocation.size <= heap.getSize());
+                auto next = live.lower_bound(allocation.offset);
+                if (next != live.end())
+                    CHECK(allocation.offset + allocation.size <= next->first);
+                if (next != live.begin())
+                    CHECK(std::prev(next)->first + std::prev(next)->second.size <= allocation.offset);
+
+                live[allocation.offset] = allocation;
+                usedSize += allocation.size;
+                CHECK(heap.getUsedSize() == usedSize);
+            }
+
+            for (const auto& [offset, allocation] : live)
+                heap.free(allocation.block);
+            HeapAllocator::Stats stats = heap.getStats();
+            CHECK(stats.freeBlockCount == 1 && stats.largestFreeBlock == heap.getSize() && stats.usedSize == 0);
+        }
+    }
+
+    // Pages filled to different levels, so the emptiest ones spill into
+    // half-full ones that would be emptied next.
+    // Three pages, emptiest first: page 1, page 2, page 0. Owner 10 does not
+    // fit the hole in page 0 until owner 11 has been moved into it and split
+    // it, so a page that took a move must not be emptied in turn.
+    void testDefragmentMovesOnce()
+    {
+        GpuMemoryPool pool(4 * MB);
+        const GpuMemoryPool::Allocation full0 = pool.allocate(4 * MB, 256, 100);
+        const GpuMemoryPool::Allocation full1 = pool.allocate(4 * MB, 256, 101);
+        const GpuMemoryPool::Allocation full2 = pool.allocate(4 * MB, 256, 102);
+
+        pool.free(full2);
+        CHECK(pool.allocate(1391104, 8 * KB, 16).page == 2);
+        pool.free(full1);
+        CHECK(pool.allocate(1182464, 64 * KB, 10).page == 1);
+        CHECK(pool.allocate(41472, MB, 11).page == 1);
+        pool.free(full0);
+        const GpuMemoryPool::Allocation hole = pool.allocate(1253376, 256, 103);
+        CHECK(pool.allocate(4 * MB - 1253376, 256, 104).page == 0);
+        pool.free(hole);
+
+        const std::vector<GpuMemoryPool::Move> moves = pool.defragment(1000);
+        CHECK(!moves.empty());
+
+        std::vector<uint64_t> owners;
+        std::vector<uint32_t> sources, targets;
+        for (const GpuMemoryPool::Move& move : moves)
+        {
+            owners.push_back(move.owner);
+            sources.push_back(move.from.page);
+            targets.push_back(move.to.page);
+        }
+
+        std::sort(owners.begin(), owners.end());
+        CHECK(std::adjacent_find(owners.begin(), owners.end()) == owners.end());
+        for (uint32_t page : targets)
+            CHECK(std::find(sources.begin(), sources.end(), page) == sources.end());
+    }
+
+    void benchmarkThroughput()
+    {
+        std::mt19937_64 random(8);
+        const int count = 100000;
+        HeapAllocator heap(4096 * MB);
+        std::vector<uint32_t> blocks;
+        blocks.reserve(count);
+
+        const int rounds = 10;
+        double seconds = 0.0;
+        for (int round = 0; round < rounds; round++)
+        {
+            std::vector<uint64_t> sizes(count);
+            for (uint64_t& size : sizes)
+                size = 256 * (1 + random() % 256);
+
+            const auto start = std::chrono::steady_clock::now();
+            for (uint64_t size : sizes)
+                blocks.push_back(heap.allocate(size, 256).block);
+            seconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+            std::shuffle(blocks.begin(), blocks.end(), random);
+
+            const auto freeStart = std::chrono::steady_clock::now();
+            for (uint32_t block : blocks)
+                heap.free(block);
+            seconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - freeStart).count();
+
+            CHECK(std::find(blocks.begin(), blocks.end(), HeapAllocator::InvalidBlock) == blocks.end());
+            CHECK(heap.isEmpty());
+            blocks.clear();
+        }
+
+        std::printf("throughput: %.1f ns per allocate + free, up to %d live blocks\n",
+            seconds * 1e9 / (static_cast<double>(rounds) * count), count);
+    }
+
+    // Mixed 64 KB to 4 MB buffers in 64 MB pages; three in four are freed,
+    // then the pool is defragmented.
+    void benchmarkFragmentation()
+    {
+        std::mt19937_64 random(9);
+        GpuMemoryPool pool(64 * MB);
+        std::map<uint64_t, GpuMemoryPool::Allocation> live;
+        for (uint64_t owner = 0; owner < 2000; owner++)
+        {
+            GpuMemoryPool::Allocation allocation = pool.allocate(64 * KB * (1 + random() % 64), 64 * KB, owner);
+            CHECK(allocation.isValid());
+            if (allocation.isValid())
+                live[owner] = allocation;
+        }
+
+        for (auto it = live.begin(); it != live.end();)
+        {
+            if (random() % 4 != 0)
+            {
+                pool.free(it->second);
+                it = live.erase(it);
+            }
+            else
+            {
+                ++it;
+            }
+        }
+
+        GpuMemoryPool::Stats before = pool.getStats();
+        const std::vector<GpuMemoryPool::Move> moves = pool.defragment(100000);
+        for (const GpuMemoryPool::Move& move : moves)
+        {
+            CHECK(live[move.owner].page == move.from.page && live[move.owner].offset == move.from.offset);
+            CHECK(move.to.offset % (64 * KB) == 0 && move.to.size == move.from.size);
+            live[move.owner] = move.to;
+        }
+        const size_t released = pool.releaseEmptyPages().size();
+        GpuMemoryPool::Stats after = pool.getStats();
+        CHECK(after.usedSize == before.usedSize && after.allocationCount == live.size());
+
+        std::printf("fragmentation: %u pages, %llu MB used in %llu MB, %u free blocks, largest %llu MB\n",
+            before.pageCount, static_cast<unsigned long long>(before.usedSize / MB),
+            static_cast<unsigned long long>(before.reservedSize / MB), before.freeBlockCount,
+            static_cast<unsigned long long>(before.largestFreeBlock / MB));
+        std::printf("defragmented: %zu moves, %zu pages released, %u pages, %llu MB used in %llu MB\n",
+            moves.size(), released, after.pageCount, static_cast<unsigned long long>(after.usedSize / MB),
+            static_cast<unsigned long long>(after.reservedSize / MB));
+
+        for (const auto& [owner, allocation] : live)
+            pool.free(allocation);
+        pool.releaseEmptyPages();
+        CHECK(pool.getStats().pageCount == 0);
+    }
+}
+
+int main()
+{
+    testExactFit();
+    testExactFitPages();
+    testAlignment();
+    testSplitMerge();
+    testReuse();
+    testRandom();
+    testDefragmentMovesOnce();
+    benchmarkThroughput();
+    benchmarkFragmentation();
+
+    if (checkFailures)
+    {
+        std::printf("HeapAllocatorTest: %d failed\n", checkFailures);
+        return 1;
+    }
+    std::printf("HeapAllocatorTest: passed\n");
+    return 0;
+}
@@ -0,0 +1,147 @@
+#include "../RenderQueue.h"
+#include "Check.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+namespace
+{
+    volatile uint64_t sink;
+
+    bool keyLess(const DrawPacket& a, const DrawPacket& b)
+    {
+        return a.key < b.key;
+    }
+
+    // Items are the push order, so comparing them checks stability too.
+    void checkSorted(RenderQueue& queue, const std::vector<uint64_t>& keys)
+    {
+        std::vector<DrawPacket> expected;
+        queue.clear();
+        for (uint32_t i = 0; i < keys.size(); i++)
+        {
+            queue.push(keys[i], i);
+            expected.push_back({ keys[i], i });
+        }
+
+        queue.sort();
+        std::stable_sort(expected.begin(), expected.end(), keyLess);
+
+        const std::vector<DrawPacket>& packets = queue.getPackets();
+        CHECK(packets.size() == expected.size());
+        bool same = packets.size() == expected.size();
+        for (size_t i = 0; same && i < packets.size(); i++)
+            same = packets[i].key == expected[i].key && packets[i].item == expected[i].item;
+        CHECK(same);
+    }
+
+    void testRandom()
+    {
+        std::mt19937_64 random(1);
+        RenderQueue queue;
+        for (size_t count : { 0, 1, 2, 3, 255, 256, 257, 1000, 100000 })
+        {
+            std::vector<uint64_t> keys(count);
+            for (uint64_t& key : keys)
+                key = random();
+            checkSorted(queue, keys);
+        }
+    }
+
+    // With every key sharing some digits only the other passes run; an odd
+    // number of them leaves the result in the scratch buffer.
+    void testSkippedDigits()
+    {
+        std::mt19937_64 random(2);
+        RenderQueue queue;
+
+        for (uint64_t mask : { 0x0ull, 0xffull, 0xff000000ull, 0xff000000000000ffull, 0x00ffff0000ff0000ull,
+            0xff00000000000000ull, 0xffffffffffffff00ull })
+        {
+            std::vector<uint64_t> keys(5000);
+            for (uint64_t& key : keys)
+                key = 0x0123456789abcdefull ^ (random() & mask);
+            checkSorted(queue, keys);
+        }
+
+        // Keys from makeKey() with one pass and two pipelines, as in a
+        // typical frame.
+        std::vector<uint64_t> keys(5000);
+        std::uniform_real_distribution<float> depth(0.0f, 1.0f);
+        for (uint64_t& key : keys)
+            key = RenderQueue::makeKey(1, random() % 2, random() % 40, depth(random), random() % 10);
+        checkSorted(queue, keys);
+    }
+
+    void testEqualKeys()
+    {
+        std::mt19937_64 random(3);
+        RenderQueue queue;
+
+        std::vector<uint64_t> keys(20000);
+        for (uint64_t& key : keys)
+            key = (random() % 8) << 40 | (random() % 3);
+        checkSorted(queue, keys);
+
+        // The same key everywhere is left in push order.
+        checkSorted(queue, std::vector<uint64_t>(1000, 0x8000000000000001ull));
+    }
+
+    // Keys shaped like the scene's: a few pipelines, a few hundred materials.
+    void benchmark(size_t count)
+    {
+        std::mt19937_64 random(4);
+        std::uniform_real_distribution<float> depth(0.0f, 1.0f);
+        std::vector<DrawPacket> input(count);
+        for (uint32_t i = 0; i < count; i++)
+            input[i] = { RenderQueue::makeKey(1, random() % 8, random() % 300, depth(random), random() % 64), i };
+
+        const int runs = std::max(3, static_cast<int>(10000000 / count));
+        RenderQueue queue;
+        std::vector<DrawPacket> packets;
+        packets.reserve(count);
+
+        // Both include refilling from the unsorted input.
+        auto start = std::chrono::steady_clock::now();
+        for (int run = 0; run < runs; run++)
+        {
+            queue.clear();
+            for (const DrawPacket& packet : input)
+                queue.push(packet.key, packet.item);
+            queue.sort();
+            sink = queue.getPackets()[count / 2].key;
+        }
+        const double radixMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / runs;
+
+        start = std::chrono::steady_clock::now();
+        for (int run = 0; run < runs; run++)
+        {
+            packets.assign(input.begin(), input.end());
+            std::sort(packets.begin(), packets.end(), keyLess);
+            sink = packets[count / 2].key;
+        }
+        const double stdMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / runs;
+
+        std::printf("%zu packets: RenderQueue::sort %.3f ms, std::sort %.3f ms\n", count, radixMs, stdMs);
+    }
+}
+
+int main()
+{
+    testRandom();
+    testSkippedDigits();
+    testEqualKeys();
+    benchmark(10000);
+    benchmark(1000000);
+
+    if (checkFailures)
+    {
+        std::printf("RenderQueueTest: %d failed\n", checkFailures);
+        return 1;
+    }
+    std::printf("RenderQueueTest: passed\n");
+    return 0;
+}
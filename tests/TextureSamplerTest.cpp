@@ -0,0 +1,148 @@
+#include "../TextureSampler.h"
+#include "Check.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+namespace
+{
+    // Keeps the timed scalar loop from being optimized out.
+    volatile float sink;
+
+    std::vector<uint8_t> randomTexels(std::mt19937& random, uint32_t width, uint32_t height)
+    {
+        std::vector<uint8_t> rgba(static_cast<size_t>(width) * height * 4);
+        for (uint8_t& channel : rgba)
+            channel = static_cast<uint8_t>(random());
+        return rgba;
+    }
+
+    // Largest difference between sample() and sampleScalar() over count
+    // random pixels, with UVs well outside [0, 1] and LODs past both ends
+    // of the chain.
+    float maxDifference(const SampledTexture& texture, std::mt19937& random, size_t count)
+    {
+        std::uniform_real_distribution<float> uv(-3.0f, 3.0f);
+        std::uniform_real_distribution<float> lod(-1.0f, static_cast<float>(texture.GetMipCount()) + 1.0f);
+        std::vector<float> u(count), v(count), l(count), r(count), g(count), b(count), a(count);
+        for (size_t i = 0; i < count; i++)
+        {
+            u[i] = uv(random);
+            v[i] = uv(random);
+            l[i] = lod(random);
+        }
+
+        texture.sample(u.data(), v.data(), l.data(), count, r.data(), g.data(), b.data(), a.data());
+
+        float difference = 0.0f;
+        for (size_t i = 0; i < count; i++)
+        {
+            float reference[4];
+            texture.sampleScalar(u[i], v[i], l[i], reference);
+            difference = std::fmax(difference, std::fabs(reference[0] - r[i]));
+            difference = std::fmax(difference, std::fabs(reference[1] - g[i]));
+            difference = std::fmax(difference, std::fabs(reference[2] - b[i]));
+            difference = std::fmax(difference, std::fabs(reference[3] - a[i]));
+        }
+        return difference;
+    }
+
+    void testTexelCenters()
+    {
+        std::mt19937 random(1);
+        const uint32_t width = 37, height = 13;
+        const std::vector<uint8_t> rgba = randomTexels(random, width, height);
+        const SampledTexture texture(rgba.data(), width, height);
+
+        // At a texel's center on mip 0 the filter returns that texel alone.
+        for (uint32_t y = 0; y < height; y++)
+        {
+            for (uint32_t x = 0; x < width; x++)
+            {
+                float sampled[4];
+                texture.sampleScalar((x + 0.5f) / width, (y + 0.5f) / height, 0.0f, sampled);
+                for (uint32_t c = 0; c < 4; c++)
+                    CHECK(std::fabs(sampled[c] * 255.0f - rgba[(y * width + x) * 4 + c]) < 1e-3f);
+            }
+        }
+    }
+
+    void testMipChain()
+    {
+        const std::vector<uint8_t> rgba(1440 * 720 * 4, 0);
+        CHECK(SampledTexture(rgba.data(), 1440, 720).GetMipCount() == 11);
+        CHECK(SampledTexture(rgba.data(), 1440, 720, false).GetMipCount() == 1);
+        CHECK(SampledTexture(rgba.data(), 1, 1).GetMipCount() == 1);
+    }
+
+    void testParity()
+    {
+        std::mt19937 random(2);
+        const uint32_t sizes[][2] = { { 1, 1 }, { 8, 8 }, { 37, 13 }, { 256, 256 }, { 1440, 720 } };
+        for (const auto& size : sizes)
+        {
+            const std::vector<uint8_t> rgba = randomTexels(random, size[0], size[1]);
+            for (bool generateMips : { false, true })
+            {
+                const SampledTexture texture(rgba.data(), size[0], size[1], generateMips);
+                // Counts that are not a multiple of 8 leave a scalar tail.
+                for (size_t count : { 0, 1, 7, 8, 9, 4099 })
+                    CHECK(maxDifference(texture, random, count) <= 1e-5f);
+            }
+        }
+    }
+
+    void benchmark()
+    {
+        std::mt19937 random(3);
+        const uint32_t width = 1440, height = 720;
+        const std::vector<uint8_t> rgba = randomTexels(random, width, height);
+        const SampledTexture texture(rgba.data(), width, height);
+
+        const size_t count = 1 << 20;
+        std::uniform_real_distribution<float> uv(-3.0f, 3.0f);
+        std::uniform_real_distribution<float> lod(0.0f, 10.0f);
+        std::vector<float> u(count), v(count), l(count), r(count), g(count), b(count), a(count);
+        for (size_t i = 0; i < count; i++)
+        {
+            u[i] = uv(random);
+            v[i] = uv(random);
+            l[i] = lod(random);
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        texture.sample(u.data(), v.data(), l.data(), count, r.data(), g.data(), b.data(), a.data());
+        const double sampleTime = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+        start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < count; i++)
+        {
+            float rgbaOut[4];
+            texture.sampleScalar(u[i], v[i], l[i], rgbaOut);
+            sink = rgbaOut[0];
+        }
+        const double scalarTime = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+        std::printf("trilinear, 1M pixels: sample %.1f ns/pixel, sampleScalar %.1f ns/pixel\n",
+            sampleTime / count, scalarTime / count);
+    }
+}
+
+int main()
+{
+    testTexelCenters();
+    testMipChain();
+    testParity();
+    benchmark();
+
+    if (checkFailures)
+    {
+        std::printf("TextureSamplerTest: %d failed\n", checkFailures);
+        return 1;
+    }
+    std::printf("TextureSamplerTest: passed\n");
+    return 0;
+}
@@ -0,0 +1,285 @@
+#include "../NullBackend.h"
+#include "../UploadRing.h"
+#include "Check.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <deque>
+#include <random>
+#include <vector>
+
+namespace
+{
+    const size_t KB = 1024;
+    const size_t MB = 1024 * KB;
+
+    volatile size_t sink;
+
+    void testAlignment()
+    {
+        UploadRing ring;
+        ring.init(64 * KB);
+
+        // Padding in front of an aligned offset is charged too.
+        size_t offset = 1;
+        CHECK(ring.allocate(10, ConstantBufferAlignment, offset) && offset == 0);
+        CHECK(ring.allocate(10, ConstantBufferAlignment, offset) && offset == 256);
+        CHECK(ring.getUsedSize() == 266);
+
+        for (size_t size : { 1, 255, 256, 257, 1000, 4096 })
+        {
+            CHECK(ring.allocate(size, ConstantBufferAlignment, offset));
+            CHECK(offset % ConstantBufferAlignment == 0);
+        }
+
+        // Smaller alignments pack tighter.
+        CHECK(ring.allocate(3, 4, offset));
+        const size_t previous = offset;
+        CHECK(ring.allocate(3, 4, offset) && offset == previous + 4);
+    }
+
+    void testWrap()
+    {
+        UploadRing ring;
+        ring.init(1024);
+
+        size_t offset;
+        CHECK(ring.allocate(400, 256, offset) && offset == 0);
+        ring.finishFrame(1);
+        CHECK(ring.allocate(400, 256, offset) && offset == 512);
+        ring.finishFrame(2);
+        CHECK(ring.getUsedSize() == 912);
+
+        // Too big for [912, 1024), so it starts over at 0 and the 112 bytes
+        // it skips belong to frame 3.
+        ring.retire(1);
+        CHECK(ring.getUsedSize() == 512);
+        CHECK(ring.allocate(300, 256, offset) && offset == 0);
+        CHECK(ring.getUsedSize() == 924);
+        ring.finishFrame(3);
+
+        ring.retire(2);
+        CHECK(ring.getUsedSize() == 412);
+        ring.retire(3);
+        CHECK(ring.getUsedSize() == 0);
+        CHECK(!ring.hasPendingFrames());
+        CHECK(ring.getPeakUsedSize() == 924);
+    }
+
+    void testRetire()
+    {
+        UploadRing ring;
+        ring.init(1024);
+
+        size_t offset;
+        CHECK(ring.allocate(512, 256, offset));
+        ring.finishFrame(1);
+        ring.retire(1);
+        CHECK(ring.getUsedSize() == 0);
+
+        // Frame 2 gets nothing, so it still remembers head = 512 from
+        // before the next allocate() starts over at 0.
+        ring.finishFrame(2);
+        CHECK(ring.allocate(256, 256, offset) && offset == 0);
+        ring.finishFrame(3);
+        ring.finishFrame(4);
+
+        // Retiring frame 2 must not move the tail to its stale head, or
+        // [256, 1024) would look like it was in use.
+        ring.retire(2);
+        CHECK(ring.getUsedSize() == 256);
+        CHECK(ring.hasPendingFrames() && ring.getOldestFenceValue() == 3);
+        CHECK(ring.allocate(700, 256, offset) && offset == 256);
+        ring.finishFrame(5);
+
+        // Fences that are not done yet keep their frames.
+        ring.retire(2);
+        CHECK(ring.getOldestFenceValue() == 3);
+        ring.retire(4);
+        CHECK(ring.getUsedSize() == 700 && ring.getOldestFenceValue() == 5);
+        ring.retire(5);
+        CHECK(ring.getUsedSize() == 0 && !ring.hasPendingFrames());
+    }
+
+    void testFull()
+    {
+        UploadRing ring;
+        ring.init(1024);
+
+        size_t offset;
+        CHECK(!ring.allocate(1025, 256, offset));
+        CHECK(ring.allocate(1024, 256, offset) && offset == 0);
+        CHECK(!ring.allocate(1, 1, offset));
+        CHECK(!ring.hasPendingFrames());
+
+        ring.finishFrame(1);
+        ring.retire(0);
+        CHECK(!ring.allocate(1, 1, offset));
+        ring.retire(1);
+        CHECK(ring.allocate(1024, 256, offset) && offset == 0);
+    }
+
+    // Frames of random allocations, retired a few at a time; nothing handed
+    // out may overlap what an unfinished frame still holds. One frame takes
+    // at most 52 KB, so it always fits on its own.
+    void testRandom()
+    {
+        struct Range
+        {
+            size_t offset;
+            size_t size;
+        };
+        struct Frame
+        {
+            uint64_t fenceValue;
+            std::vector<Range> ranges;
+        };
+
+        std::mt19937_64 random(1);
+        const size_t capacity = 64 * KB;
+        UploadRing ring;
+        ring.init(capacity);
+
+        std::deque<Frame> frames;
+        uint64_t fenceValue = 0;
+        uint64_t completed = 0;
+        for (int frame = 0; frame < 2000; frame++)
+        {
+            Frame current = { ++fenceValue, {} };
+            const int count = static_cast<int>(random() % 12);
+            for (int i = 0; i < count; i++)
+            {
+                const size_t size = 1 + random() % (4 * KB);
+                const size_t alignment = size_t(1) << (random() % 9);
+
+                size_t offset;
+                while (!ring.allocate(size, alignment, offset))
+                {
+                    CHECK(ring.hasPendingFrames() && !frames.empty());
+                    if (frames.empty())
+                        return;
+                    completed = ring.getOldestFenceValue();
+                    ring.retire(completed);
+                    frames.pop_front();
+                }
+
+                CHECK(offset % alignment == 0 && offset + size <= capacity);
+                for (const Frame& live : frames)
+                {
+                    for (const Range& range : live.ranges)
+                        CHECK(offset + size <= range.offset || range.offset + range.size <= offset);
+                }
+                for (const Range& range : current.ranges)
+                    CHECK(offset + size <= range.offset || range.offset + range.size <= offset);
+                current.ranges.push_back({ offset, size });
+            }
+
+            ring.finishFrame(current.fenceValue);
+            frames.push_back(current);
+
+            // The GPU catches up on zero to three frames.
+            completed = std::min(fenceValue, completed + random() % 4);
+            ring.retire(completed);
+            while (!frames.empty() && frames.front().fenceValue <= completed)
+                frames.pop_front();
+
+            size_t live = 0;
+            for (const Frame& pending : frames)
+            {
+                for (const Range& range : pending.ranges)
+                    live += range.size;
+            }
+            CHECK(ring.getUsedSize() >= live && ring.getUsedSize() <= capacity);
+        }
+
+        ring.retire(fenceValue);
+        CHECK(ring.getUsedSize() == 0);
+    }
+
+    // 6 MB a frame with three frames in flight does not fit the 16 MB ring,
+    // so the third frame has to wait in allocateUpload() for the first.
+    void testNullBackendWait()
+    {
+        NullBackend backend(3);
+        backend.setFrameGpuTime(5000000);
+        backend.init(64, 64);
+
+        const float clearColor[4] = {};
+        for (int frame = 0; frame < 8; frame++)
+        {
+            backend.beginFrame(clearColor);
+
+            const uint64_t stallBefore = backend.getDevice().getStallTime();
+            const UploadAllocation allocation = backend.allocateUpload(6 * MB, ConstantBufferAlignment);
+            CHECK(allocation.data != nullptr && allocation.offset % ConstantBufferAlignment == 0);
+            CHECK(allocation.offset + 6 * MB <= UploadRingSize);
+            if (allocation.data)
+                memset(allocation.data, frame, 6 * MB);
+            if (frame >= 2)
+                CHECK(backend.getDevice().getStallTime() > stallBefore);
+
+            backend.submitFrame();
+            backend.present();
+        }
+
+        // More than the ring can ever hold fails instead of waiting forever.
+        CHECK(backend.allocateUpload(UploadRingSize + 1, ConstantBufferAlignment).data == nullptr);
+
+        backend.destroy();
+        CHECK(backend.getUploadRing().getUsedSize() == 0);
+
+        for (const NullDeviceLogEntry& entry : backend.getDevice().getLog())
+            CHECK(entry.call != NullDeviceCall::Error);
+    }
+
+    // One small allocation per object, 50k objects a frame, three frames in
+    // flight.
+    void benchmarkThroughput()
+    {
+        const size_t instances = 50000;
+        const size_t instanceSize = 56;
+        const uint64_t framesInFlight = 3;
+        UploadRing ring;
+        ring.init(UploadRingSize);
+
+        const int frames = 100;
+        size_t offset = 0;
+        const auto start = std::chrono::steady_clock::now();
+        for (int frame = 1; frame <= frames; frame++)
+        {
+            if (frame > static_cast<int>(framesInFlight))
+                ring.retire(frame - framesInFlight);
+
+            for (size_t i = 0; i < instances; i++)
+            {
+                CHECK(ring.allocate(instanceSize, 16, offset));
+                sink = offset;
+            }
+            ring.finishFrame(frame);
+        }
+        const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        std::printf("throughput: %.2f ns per allocate, %zu KB peak of %zu KB\n",
+            seconds * 1e9 / (static_cast<double>(frames) * instances), ring.getPeakUsedSize() / KB, UploadRingSize / KB);
+    }
+}
+
+int main()
+{
+    testAlignment();
+    testWrap();
+    testRetire();
+    testFull();
+    testRandom();
+    testNullBackendWait();
+    benchmarkThroughput();
+
+    if (checkFailures)
+    {
+        std::printf("UploadRingTest: %d failed\n", checkFailures);
+        return 1;
+    }
+    std::printf("UploadRingTest: passed\n");
+    return 0;
+}